@@ -0,0 +1,91 @@
+#include <chrono>
+#include <charconv>
+#include <cstddef>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include <csv2/reader.hpp>
+#include <incplot-lib_private/csv_tokenizer.hpp>
+#include <incstd/incstd_all.hpp>
+#include <tests_config.hpp>
+
+
+// Compares the in-tree vectorized tokenizer against csv2 row/cell iteration on the test datasets scaled up
+// Usage: incplot_csv_tokenizer_bench [scale factor (default 200)]
+
+using namespace incom::terminal_plot;
+using namespace incom::terminal_plot::testing;
+
+namespace {
+// Header stays, data rows are repeated 'scale' times
+std::string scale_dataSet(std::string_view const data, size_t const scale) {
+    size_t const hdrEnd = data.find('\n');
+    std::string  rows(data.substr(hdrEnd + 1));
+    if (not rows.empty() && rows.back() != '\n') { rows.push_back('\n'); }
+
+    std::string res(data.substr(0, hdrEnd + 1));
+    res.reserve(res.size() + rows.size() * scale);
+    for (size_t i = 0; i < scale; ++i) { res.append(rows); }
+    return res;
+}
+
+// Both contenders 'touch' every field the same way so that the work can't get optimized away
+template <char delim>
+size_t run_csv2(std::string_view const data) {
+    csv2::Reader<csv2::delimiter<delim>, csv2::quote_character<'"'>, csv2::first_row_is_header<true>,
+                 csv2::trim_policy::trim_whitespace>
+        reader;
+    if (not reader.parse_view(data)) { return 0; }
+
+    size_t checksum = 0;
+    for (auto const &row : reader) {
+        for (auto const &cell : row) { checksum += cell.read_view().size() + 1; }
+    }
+    return checksum;
+}
+
+template <char delim>
+size_t run_tokenizer(std::string_view const data) {
+    size_t checksum = 0;
+    detail::csv_tokenizer::tokenize<delim>(
+        data.substr(data.find('\n') + 1),
+        [&](size_t, std::string_view const field) { checksum += field.size() + 1; }, [](size_t) { return true; });
+    return checksum;
+}
+
+template <char delim>
+void bench_one(std::string_view const fileName, size_t const scale) {
+    auto textual = incstd::filesys::get_file_textual(fileName);
+    if (not textual.has_value()) {
+        std::println("{:<52} could not be read", fileName);
+        return;
+    }
+    std::string const data = scale_dataSet(textual.value(), scale);
+
+    auto time_it = [&](auto &&fn) {
+        auto const   beg      = std::chrono::steady_clock::now();
+        size_t const checksum = fn(std::string_view(data));
+        auto const   dur      = std::chrono::duration<double>(std::chrono::steady_clock::now() - beg).count();
+        return std::pair(checksum, (static_cast<double>(data.size()) / (1024.0 * 1024.0)) / dur);
+    };
+
+    auto const [csv2_sum, csv2_mbps] = time_it(run_csv2<delim>);
+    auto const [tok_sum, tok_mbps]   = time_it(run_tokenizer<delim>);
+    std::println("{:<52} {:>8.1f} MiB | csv2 {:>8.1f} MiB/s | tokenizer {:>8.1f} MiB/s | x{:.2f}{}", fileName,
+                 static_cast<double>(data.size()) / (1024.0 * 1024.0), csv2_mbps, tok_mbps, tok_mbps / csv2_mbps,
+                 csv2_sum == tok_sum ? "" : " (checksum mismatch)");
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+    size_t scale = 200;
+    if (argc > 1) {
+        std::string_view const arg(argv[1]);
+        std::from_chars(arg.data(), arg.data() + arg.size(), scale);
+    }
+
+    for (auto const &oneFN : DataSets_FN_transposed::csv) { bench_one<','>(oneFN, scale); }
+    for (auto const &oneFN : DataSets_FN_transposed::tsv) { bench_one<'\t'>(oneFN, scale); }
+    return 0;
+}
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <incplot-lib/arrow_c.hpp>
+#include <incplot-lib/bitmap.hpp>
+#include <incplot-lib/datastore_builder.hpp>
+#include <incplot-lib/input_buffer.hpp>
 #include <incplot-lib/parsers_inc.hpp>
 #include <incplot-lib/plot_structures.hpp>
+#include <incplot-lib/snapshot.hpp>
 #include <variant>
 
 
@@ -23,11 +28,21 @@ INCPLOT_LIB_API std::expected<std::string, incerr_c> make_plot(DesiredPlot &&dp_
 inline std::expected<std::string, incerr_c>          make_plot(DesiredPlot const &dp_ctrs, std::string_view inputData) {
     return make_plot(DesiredPlot(dp_ctrs), inputData);
 }
+// Same as make_plot above except the data is already in a DataStore, so nothing gets parsed
+// (see 'DataStoreBuilder' for creating one directly out of columns held in memory)
+INCPLOT_LIB_API std::expected<std::string, incerr_c> make_plot(DesiredPlot &&dp_ctrs, DataStore const &ds);
+inline std::expected<std::string, incerr_c>          make_plot(DesiredPlot const &dp_ctrs, DataStore const &ds) {
+    return make_plot(DesiredPlot(dp_ctrs), ds);
+}
 // Same as make_plot except also collapses (potential) unexpected result into a string.
 INCPLOT_LIB_API std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, std::string_view inputData);
 inline std::string          make_plot_collapseUnExp(DesiredPlot const &dp_ctrs, std::string_view inputData) {
     return make_plot_collapseUnExp(DesiredPlot(dp_ctrs), inputData);
 }
+INCPLOT_LIB_API std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, DataStore const &ds);
+inline std::string          make_plot_collapseUnExp(DesiredPlot const &dp_ctrs, DataStore const &ds) {
+    return make_plot_collapseUnExp(DesiredPlot(dp_ctrs), ds);
+}
 
 // Renders all the parts of a plot (data members of the 'plot_structures' types) and returns it
 INCPLOT_LIB_API std::expected<var_plotTypes, incerr_c> build_plotStructure(DesiredPlot const &dp, DataStore const &ds);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+
+#include <incplot-lib/_common.hpp>
+#include <incplot-lib/datastore.hpp>
+#include <incplot-lib/err.hpp>
+
+
+// ABI of the Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html)
+// Guarded the same as in Arrow itself, so that it can be included together with Arrow headers
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char          *format;
+    const char          *name;
+    const char          *metadata;
+    int64_t              flags;
+    int64_t              n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema  *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t             length;
+    int64_t             null_count;
+    int64_t             offset;
+    int64_t             n_buffers;
+    int64_t             n_children;
+    const void        **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray  *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+
+namespace incom {
+namespace terminal_plot {
+
+// Exchange of DataStore with Arrow based tooling in the same process (no dependency on any Arrow library)
+// DataStore corresponds to a struct array ('+s') whose children are the columns
+// Validity bitmaps correspond to the 'null' bit (0b1) of 'itemFlags'
+namespace arrow_c {
+
+using incerr_c = incerr::incerr_code;
+
+// Takes over both 'schema' and 'array' (the structs passed in are marked as released)
+// Integer (including boolean) columns become long long, floating point columns become double
+// Unsigned 64bit column with any (non-null) value above the range of long long is rejected instead of wrapping around
+// String cells ('u' and 'U') are views into the array, which is then released only once the DataStore is destroyed
+// Values of primitive columns are bulk copied (or just widened) without any parsing
+INCPLOT_LIB_API std::expected<DataStore, incerr_c> from_arrow(ArrowSchema *schema, ArrowArray *array);
+
+// Exported schema and array own copies of the data, so they remain valid after the DataStore is gone
+// The caller is responsible for releasing them (through their 'release' callbacks)
+INCPLOT_LIB_API void to_arrow(DataStore const &ds, ArrowSchema *out_schema, ArrowArray *out_array);
+
+} // namespace arrow_c
+} // namespace terminal_plot
+} // namespace incom
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace incom {
+namespace terminal_plot {
+
+// Per-row flags packed one bit per row into 64bit words (instead of an 'unsigned int' per row)
+// Reads like a range of 'unsigned int' flags (0b1 for the rows that are flagged, 0b0 otherwise), so it stands in for
+// the per-row vectors of flags wherever those are accessed row by row
+// Whole-bitmap operations (combining, counting, finding the rows that are (not) flagged) work on entire words
+// Bits past 'size()' in the last word are always kept at zero, so that the words can be compared and counted directly
+class Bitmap {
+public:
+    using word_t                        = uint64_t;
+    static constexpr size_t bitsPerWord = 64;
+
+private:
+    std::vector<word_t> m_words;
+    size_t              m_size = 0;
+
+    static constexpr size_t get_wordCount(size_t const bitCount) { return (bitCount + bitsPerWord - 1) / bitsPerWord; }
+    static constexpr word_t get_mask(size_t const pos) { return word_t{1} << (pos % bitsPerWord); }
+
+    void clear_tail() {
+        if (m_size % bitsPerWord != 0) { m_words.back() &= get_mask(m_size) - 1; }
+    }
+    // Word with the bits of the rows which are NOT flagged set (bits past 'size()' stay zero)
+    word_t get_invertedWord(size_t const wordID) const {
+        word_t const inverted = ~m_words[wordID];
+        if (wordID + 1 == m_words.size() && m_size % bitsPerWord != 0) { return inverted & (get_mask(m_size) - 1); }
+        return inverted;
+    }
+
+public:
+    // Proxy returned by the non-const subscript (the same as in std::vector<bool>)
+    class reference {
+    private:
+        word_t *m_word;
+        word_t  m_mask;
+
+    public:
+        reference(word_t *word, word_t const mask) : m_word(word), m_mask(mask) {}
+        reference(reference const &) = default;
+
+        operator unsigned int() const { return (*m_word & m_mask) ? 0b1u : 0b0u; }
+        reference &operator=(unsigned int const flag) {
+            if (flag & 0b1) { *m_word |= m_mask; }
+            else { *m_word &= ~m_mask; }
+            return *this;
+        }
+        reference &operator=(reference const &other) { return *this = static_cast<unsigned int>(other); }
+        reference &operator|=(unsigned int const flag) {
+            if (flag & 0b1) { *m_word |= m_mask; }
+            return *this;
+        }
+    };
+
+    class const_iterator {
+    private:
+        Bitmap const *m_bitmap = nullptr;
+        size_t        m_pos    = 0;
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type       = unsigned int;
+        using difference_type  = std::ptrdiff_t;
+
+        const_iterator() = default;
+        const_iterator(Bitmap const *bitmap, size_t const pos) : m_bitmap(bitmap), m_pos(pos) {}
+
+        unsigned int    operator*() const { return (*m_bitmap)[m_pos]; }
+        const_iterator &operator++() {
+            ++m_pos;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            ++m_pos;
+            return tmp;
+        }
+        bool operator==(const_iterator const &other) const { return m_pos == other.m_pos; }
+    };
+
+    // Positions of the rows that are flagged ('SET') or not flagged, found with 'countr_zero' a word at a time
+    // Words without any such row are skipped as a whole
+    template <bool SET>
+    class pos_iterator {
+    private:
+        Bitmap const *m_bitmap = nullptr;
+        size_t        m_wordID = 0;
+        word_t        m_rest   = 0; // Not yet visited bits of the current word
+
+        word_t get_word(size_t const wordID) const {
+            return SET ? m_bitmap->m_words[wordID] : m_bitmap->get_invertedWord(wordID);
+        }
+        void skip_emptyWords() {
+            while (m_rest == 0 && m_wordID + 1 < m_bitmap->m_words.size()) { m_rest = get_word(++m_wordID); }
+        }
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type       = size_t;
+        using difference_type  = std::ptrdiff_t;
+
+        pos_iterator() = default;
+        explicit pos_iterator(Bitmap const *bitmap) : m_bitmap(bitmap) {
+            if (not m_bitmap->m_words.empty()) {
+                m_rest = get_word(0);
+                skip_emptyWords();
+            }
+        }
+
+        size_t        operator*() const { return m_wordID * bitsPerWord + std::countr_zero(m_rest); }
+        pos_iterator &operator++() {
+            m_rest &= m_rest - 1;
+            skip_emptyWords();
+            return *this;
+        }
+        pos_iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(pos_iterator const &other) const {
+            return m_wordID == other.m_wordID && m_rest == other.m_rest;
+        }
+        bool operator==(std::default_sentinel_t) const { return m_rest == 0; }
+    };
+
+
+    // CONSTRUCTION
+    Bitmap() = default;
+    explicit Bitmap(size_t const count, unsigned int const flag = 0b0)
+        : m_words(get_wordCount(count), (flag & 0b1) ? ~word_t{0} : word_t{0}), m_size(count) {
+        clear_tail();
+    }
+    Bitmap(std::initializer_list<unsigned int> const flags) {
+        reserve(flags.size());
+        for (auto const flag : flags) { push_back(flag); }
+    }
+    // Takes over already packed words (the bits past 'count' are cleared)
+    static Bitmap from_words(std::vector<word_t> &&words, size_t const count) {
+        assert(words.size() == get_wordCount(count));
+        Bitmap res;
+        res.m_words = std::move(words);
+        res.m_size  = count;
+        res.clear_tail();
+        return res;
+    }
+
+    // SIZE
+    size_t size() const { return m_size; }
+    bool   empty() const { return m_size == 0; }
+    void   reserve(size_t const count) { m_words.reserve(get_wordCount(count)); }
+    void   clear() {
+        m_words.clear();
+        m_size = 0;
+    }
+    void resize(size_t const count, unsigned int const flag = 0b0) {
+        size_t const oldSize = m_size;
+        m_words.resize(get_wordCount(count), (flag & 0b1) ? ~word_t{0} : word_t{0});
+        m_size = count;
+        if ((flag & 0b1) && count > oldSize && oldSize % bitsPerWord != 0) {
+            m_words[oldSize / bitsPerWord] |= ~(get_mask(oldSize) - 1);
+        }
+        clear_tail();
+    }
+
+    // ACCESS
+    bool         test(size_t const pos) const { return m_words[pos / bitsPerWord] & get_mask(pos); }
+    unsigned int operator[](size_t const pos) const { return test(pos) ? 0b1u : 0b0u; }
+    reference    operator[](size_t const pos) { return reference(&m_words[pos / bitsPerWord], get_mask(pos)); }
+    unsigned int at(size_t const pos) const {
+        if (pos >= m_size) { throw std::out_of_range("Bitmap::at"); }
+        return (*this)[pos];
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_size); }
+
+    auto get_setPositions() const { return std::ranges::subrange(pos_iterator<true>(this), std::default_sentinel); }
+    auto get_unsetPositions() const {
+        return std::ranges::subrange(pos_iterator<false>(this), std::default_sentinel);
+    }
+
+    // Positions of the rows that are NOT flagged collected into one compact vector (a 'selection vector')
+    // Positions are 32bit (half the memory of 'size_t'), row counts don't get anywhere near that limit
+    std::vector<uint32_t> get_selection() const {
+        assert(m_size <= std::numeric_limits<uint32_t>::max());
+        std::vector<uint32_t> res;
+        res.reserve(m_size - count());
+        for (size_t wordID = 0; wordID < m_words.size(); ++wordID) {
+            for (word_t rest = get_invertedWord(wordID); rest != 0; rest &= rest - 1) {
+                res.push_back(static_cast<uint32_t>(wordID * bitsPerWord + std::countr_zero(rest)));
+            }
+        }
+        return res;
+    }
+
+    std::vector<word_t> const &get_words() const { return m_words; }
+
+    // MODIFICATION
+    void push_back(unsigned int const flag) {
+        if (m_size % bitsPerWord == 0) { m_words.push_back(0); }
+        if (flag & 0b1) { m_words.back() |= get_mask(m_size); }
+        ++m_size;
+    }
+    void append(Bitmap const &other) {
+        size_t const oldSize = m_size;
+        resize(oldSize + other.m_size);
+        size_t const firstWordID = oldSize / bitsPerWord;
+        size_t const bitShift    = oldSize % bitsPerWord;
+        if (bitShift == 0) {
+            std::copy(other.m_words.begin(), other.m_words.end(), m_words.begin() + firstWordID);
+            return;
+        }
+        for (size_t wordID = 0; wordID < other.m_words.size(); ++wordID) {
+            m_words[firstWordID + wordID] |= other.m_words[wordID] << bitShift;
+            if (firstWordID + wordID + 1 < m_words.size()) {
+                m_words[firstWordID + wordID + 1] |= other.m_words[wordID] >> (bitsPerWord - bitShift);
+            }
+        }
+    }
+    // Drops the first 'count' rows (everything else moves towards the front)
+    void erase_front(size_t const count = 1) {
+        assert(count <= m_size);
+        size_t const wordShift = count / bitsPerWord;
+        size_t const bitShift  = count % bitsPerWord;
+        m_words.erase(m_words.begin(), m_words.begin() + wordShift);
+        if (bitShift != 0) {
+            for (size_t wordID = 0; wordID < m_words.size(); ++wordID) {
+                m_words[wordID] >>= bitShift;
+                if (wordID + 1 < m_words.size()) { m_words[wordID] |= m_words[wordID + 1] << (bitsPerWord - bitShift); }
+            }
+        }
+        m_size -= count;
+        m_words.resize(get_wordCount(m_size));
+    }
+
+    // WHOLE BITMAP OPERATIONS
+    // Both bitmaps must be of the same size, the loops over the words are simple enough to get vectorized
+    Bitmap &operator|=(Bitmap const &other) {
+        assert(m_size == other.m_size);
+        for (size_t wordID = 0; wordID < m_words.size(); ++wordID) { m_words[wordID] |= other.m_words[wordID]; }
+        return *this;
+    }
+    Bitmap &operator&=(Bitmap const &other) {
+        assert(m_size == other.m_size);
+        for (size_t wordID = 0; wordID < m_words.size(); ++wordID) { m_words[wordID] &= other.m_words[wordID]; }
+        return *this;
+    }
+    friend Bitmap operator|(Bitmap lhs, Bitmap const &rhs) { return lhs |= rhs; }
+    friend Bitmap operator&(Bitmap lhs, Bitmap const &rhs) { return lhs &= rhs; }
+
+    // Number of flagged rows
+    size_t count() const {
+        size_t res = 0;
+        for (auto const word : m_words) { res += static_cast<size_t>(std::popcount(word)); }
+        return res;
+    }
+    bool any() const {
+        for (auto const word : m_words) {
+            if (word != 0) { return true; }
+        }
+        return false;
+    }
+    bool none() const { return not any(); }
+
+    bool operator==(Bitmap const &other) const = default;
+};
+
+} // namespace terminal_plot
+} // namespace incom
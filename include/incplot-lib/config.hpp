@@ -64,6 +64,28 @@ public:
 
     static inline constexpr bool forceRGB_bool_default = false;
 
+    // PARSING
+    // Size of one read from the input when parsing from a stream, memory use of streamed parsing is bounded by this
+    // (plus the size of the longest line)
+    static inline size_t parser_streamChunkSize = 1uz << 20;
+    // Number of CSV/TSV data rows pre-assessed for column types before parsing
+    // Types that only show up later are still handled (by promoting the column), this just makes that rarer
+    static inline size_t parser_typeSampleRows = 64;
+    // Number of threads CSV/TSV data rows and NDJSON lines are parsed on (0 means as many as there are hardware threads)
+    static inline size_t parser_threadCount = 0;
+    // Inputs are split for parallel parsing only into chunks at least this big
+    static inline size_t parser_parallelMinChunkSize = 1uz << 22;
+    // Size of the samples (at the beginning and at the end) the input format is assessed from before scanning it whole
+    static inline size_t parser_detectSampleSize = 1uz << 16;
+    // CSV/TSV string cells are kept as views into the input (which the DataStore then keeps alive) instead of copies
+    // Only applies when the DataStore is loaded from a file through 'DataStore::get_DS'
+    static inline bool parser_zeroCopyStrings = false;
+    // CSV/TSV columns are only indexed at first and each gets converted when it is first accessed (implies zero-copy)
+    // Only applies when the DataStore is loaded from a file through 'DataStore::get_DS'
+    static inline bool parser_lazyColumns = false;
+    // Number of decompressed chunks (of 'parser_streamChunkSize') gzip/zstd input is decompressed ahead of the parsing
+    static inline size_t parser_decompressAheadChunks = 2;
+
 
     // COLORS
     static inline const std::string_view color_Axes = ANSI::get_fg(ANSI_Color16::Bright_Black);
@@ -1,16 +1,26 @@
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include <ankerl/unordered_dense.h>
 #include <incplot-lib/_common.hpp>
+#include <incplot-lib/bitmap.hpp>
+#include <incplot-lib/input_buffer.hpp>
 
 
 namespace incom {
@@ -27,89 +37,245 @@ enum class parsedVal_t {
 class INCPLOT_LIB_API DataStore {
 public:
     // TYPE ALIAS
-    using varCol_t        = std::variant<std::vector<std::string>, std::vector<long long>, std::vector<double>>;
+    // String cells are either owned or (when parsed 'zero-copy') views into one of the pinned input buffers
+    // Visitors of 'varCol_t' (and 'std::get' by index) therefore need to handle the string_view alternative as well
+    // Views only save the copy made while parsing, plots still copy the cells they render (see 'ownedCol_t')
+    using varCol_t = std::variant<std::vector<std::string>, std::vector<long long>, std::vector<double>,
+                                  std::vector<std::string_view>>;
     using vec_pr_varCol_t = std::vector<std::pair<std::string, varCol_t>>;
+    // Column data copied out of the DataStore (string cells are always owned)
+    using ownedCol_t = std::variant<std::vector<std::string>, std::vector<long long>, std::vector<double>>;
+
+    // Positions of the fields of one column within the input (which must outlive the DataStore)
+    // Lazily parsed columns keep just this, their values are converted on first access
+    struct FieldIndex {
+        std::string_view           input;     // Part of the input that all the fields are in
+        std::vector<size_t>        fieldBegs; // Byte offsets into 'input'
+        std::vector<uint32_t>      fieldSizes;
+        bool                       zeroCopyStrings = false;
+        // Type the column is converted into instead of being inferred (cells that fail to convert are then null)
+        std::optional<parsedVal_t> typeHint = std::nullopt;
+
+        size_t           size() const { return fieldBegs.size(); }
+        std::string_view get_field(size_t const rowID) const {
+            return input.substr(fieldBegs[rowID], fieldSizes[rowID]);
+        }
+        void push_back(std::string_view const field) {
+            fieldBegs.push_back(static_cast<size_t>(field.data() - input.data()));
+            fieldSizes.push_back(static_cast<uint32_t>(field.size()));
+        }
+        // Appends fields indexed in a later part of the same input
+        void append(FieldIndex const &other);
+    };
 
     struct DS_CtorObj {
         std::vector<std::pair<std::string, varCol_t>> data;
-        std::vector<std::vector<unsigned int>>        itemFlags;
+        std::vector<Bitmap>                           itemFlags;
+        // Number of rows of the input when 'data' holds just a sample of them (nullopt when all of them are there)
+        std::optional<size_t>                         sourceRowCount = std::nullopt;
+        // One per column when the columns are parsed lazily (their 'data' and 'itemFlags' are then left empty)
+        std::vector<FieldIndex>                       fieldIndices = {};
+        // Text of the cells of the columns that are not strings (yet), one per column (empty for string columns)
+        // Column promoted into strings while being parsed then keeps its cells exactly as they are in the input
+        // Kept only while the input is being parsed, it is never carried over into the DataStore
+        std::vector<FieldIndex>                       sourceFields = {};
+
+        size_t get_rowCount() const {
+            if (not fieldIndices.empty()) { return fieldIndices.front().size(); }
+            return itemFlags.empty() ? 0uz : itemFlags.front().size();
+        }
+    };
+    // Dictionary encoded ('categorical') representation of a string column
+    // Every row has a code which is an index into the dictionary, dictionary items are kept in order of first
+    // appearance together with the count of their occurences
+    // Kept in addition to the string cells (which remain the storage of the column) so that category IDs and counts
+    // need not be re-derived by every plot
+    // Rows are encoded whenever they get into the DataStore (constructed, appended or converted from a lazy column),
+    // not by the parsers themselves, so parallel chunks never have dictionaries of their own to merge
+    struct CatDict {
+        struct StrHash {
+            using is_transparent = void;
+            using is_avalanching = void;
+            uint64_t operator()(std::string_view const sv) const noexcept {
+                return ankerl::unordered_dense::hash<std::string_view>{}(sv);
+            }
+        };
+        // Key = category, Value = count of its occurences
+        using dict_t = ankerl::unordered_dense::map<std::string, size_t, StrHash, std::equal_to<>>;
+
+        std::vector<uint32_t> codes;
+        dict_t                dict;
+
+        size_t             get_categoryCount() const { return dict.size(); }
+        std::string const &get_category(uint32_t const code) const { return dict.values()[code].first; }
+        size_t             get_count(uint32_t const code) const { return dict.values()[code].second; }
+
+        // Encodes one more row
+        void push_back(std::string_view const sv);
+
+        // Rows not flagged in 'itemFlags_ext' only, categories with no rows left have count of 0
+        CatDict get_filtered(Bitmap const &itemFlags_ext) const;
+        // Rows at the positions in 'selection' only (see 'Bitmap::get_selection'), counts are of those rows
+        CatDict get_selected(std::span<uint32_t const> const selection) const;
+
+        // Categories sorted by value (categories with count of 0 are skipped)
+        std::vector<std::string> get_sortedCategories() const;
+        // For each row the position of its category in 'get_sortedCategories()'
+        std::vector<size_t> get_sortedIDs() const;
+    };
+
+    // Rows that are left out of a plot, one bitmap per reason (all of them of the same size as the columns)
+    struct FilterFlags {
+        Bitmap nulls;         // 'null' in any of the plotted columns
+        Bitmap outsideStdDev; // Extreme value (see 'DesiredPlot::filter_outsideStdDev') in any of the plotted columns
+        Bitmap combined;      // Either of the above, this is what the data get filtered by
+
+        size_t get_filteredCount() const { return combined.count(); }
+        size_t get_unfilteredCount() const { return combined.size() - combined.count(); }
     };
-    struct Column {
-        std::string               name;
-        parsedVal_t               colType;
-        std::vector<unsigned int> itemFlags;
-        varCol_t                  variant_data;
+
+    // Lazily parsed column is converted (from its 'FieldIndex') on first access through any of the getters
+    // The conversion runs exactly once even when the (const) getters are called from multiple threads at once
+    // Values are only reachable through the getters, so nothing can observe a column that is not converted yet
+    class Column {
+    public:
+        std::string name;
+
+        Column() = default;
+        // String columns get their 'CatDict' built (unless it is passed in)
+        Column(std::string name, Bitmap itemFlags, varCol_t data, std::optional<CatDict> catDict = std::nullopt);
+        // Lazily parsed column, its type (and values) are decided only once it is converted
+        Column(std::string name, std::shared_ptr<FieldIndex const> fieldIndex);
+
+        // Copying a lazy column converts it first (so that there is no conversion in flight while being copied)
+        Column(Column const &other);
+        Column &operator=(Column const &other);
+        Column(Column &&other) noexcept            = default;
+        Column &operator=(Column &&other) noexcept = default;
+
+        bool is_materialized() const { return m_lazy == nullptr || m_lazy->done.load(std::memory_order_acquire); }
+        void materialize() const;
+
+        size_t get_rowCount() const { return is_materialized() ? m_itemFlags.size() : m_lazy->rowCount; }
+
+        parsedVal_t get_colType() const {
+            materialize();
+            return m_colType;
+        }
+        Bitmap const &get_itemFlags() const {
+            materialize();
+            return m_itemFlags;
+        }
+        std::optional<CatDict> const &get_catDict() const {
+            materialize();
+            return m_catDict;
+        }
 
         template <typename CT>
         const auto &get_data() const {
-            assert(std::holds_alternative<CT>(variant_data));
-            return std::get<CT>(variant_data);
+            materialize();
+            assert(std::holds_alternative<CT>(m_variantData));
+            return std::get<CT>(m_variantData);
+        }
+
+        const auto &get_variantData() const {
+            materialize();
+            return m_variantData;
+        }
+
+        // Rows not flagged in 'flags' (visited a word of the bitmap at a time), items are references into 'vec'
+        template <typename VEC>
+        static auto view_unflagged(VEC const &vec, Bitmap const &flags) {
+            return flags.get_unsetPositions() |
+                   std::views::transform([&vec](size_t const rowID) -> auto const & { return vec[rowID]; });
         }
 
-        const auto &get_variantData() const { return variant_data; }
+        auto get_filteredVariantData(Bitmap const &itemFlags_ext) const {
+            materialize();
+            if (itemFlags_ext.size() != m_itemFlags.size()) { assert(false); }
 
-        auto get_filteredVariantData() const {
-            auto fltr = [&, i = 0uz](auto &&_) mutable { return itemFlags[i++] == 0b0; };
+            using res_t = std::variant<decltype(view_unflagged(std::get<0>(m_variantData), itemFlags_ext)),
+                                       decltype(view_unflagged(std::get<1>(m_variantData), itemFlags_ext)),
+                                       decltype(view_unflagged(std::get<2>(m_variantData), itemFlags_ext)),
+                                       decltype(view_unflagged(std::get<3>(m_variantData), itemFlags_ext))>;
 
-            using res_t = std::variant<decltype(std::views::filter(std::get<0>(variant_data), fltr)),
-                                       decltype(std::views::filter(std::get<1>(variant_data), fltr)),
-                                       decltype(std::views::filter(std::get<2>(variant_data), fltr))>;
+            auto visi = [&](auto const &vari) { return res_t(view_unflagged(vari, itemFlags_ext)); };
+            return std::visit(visi, m_variantData);
+        }
+
+        auto get_filteredVariantData() const { return get_filteredVariantData(get_itemFlags()); }
+
+        // Rows at the positions in 'selection' (sized random access view, items are references into 'vec')
+        template <typename VEC>
+        static auto view_selected(VEC const &vec, std::span<uint32_t const> const selection) {
+            return selection |
+                   std::views::transform([&vec](uint32_t const rowID) -> auto const & { return vec[rowID]; });
+        }
 
-            auto visi = [&](auto const &vari) {
-                if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<std::string>>) {
-                    return res_t(std::views::filter(std::get<0>(variant_data), fltr));
-                }
-                else if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<long long>>) {
-                    return res_t(std::views::filter(std::get<1>(variant_data), fltr));
-                }
-                else if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<double>>) {
-                    return res_t(std::views::filter(std::get<2>(variant_data), fltr));
-                }
+        auto get_selectedVariantData(std::span<uint32_t const> const selection) const {
+            materialize();
 
-                else { static_assert(false); }
-                std::unreachable();
-            };
+            using res_t = std::variant<decltype(view_selected(std::get<0>(m_variantData), selection)),
+                                       decltype(view_selected(std::get<1>(m_variantData), selection)),
+                                       decltype(view_selected(std::get<2>(m_variantData), selection)),
+                                       decltype(view_selected(std::get<3>(m_variantData), selection))>;
 
-            return std::visit(visi, variant_data);
+            auto visi = [&](auto const &vari) { return res_t(view_selected(vari, selection)); };
+            return std::visit(visi, m_variantData);
         }
 
-        auto get_filteredVariantData(std::vector<unsigned int> const &itemFlags_ext) const {
-            if (itemFlags_ext.size() != itemFlags.size()) { assert(false); }
-
-            auto fltr   = [](auto &&a) { return std::get<0>(a) == 0; };
-            auto transf = [](auto &&b) { return std::get<1>(b); };
-
-            using res_t = std::variant<decltype(std::views::zip(itemFlags_ext, std::get<0>(variant_data)) |
-                                                std::views::filter(fltr) | std::views::transform(transf)),
-                                       decltype(std::views::zip(itemFlags_ext, std::get<1>(variant_data)) |
-                                                std::views::filter(fltr) | std::views::transform(transf)),
-                                       decltype(std::views::zip(itemFlags_ext, std::get<2>(variant_data)) |
-                                                std::views::filter(fltr) | std::views::transform(transf))>;
-
-            auto visi = [&](auto const &vari) {
-                if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<std::string>>) {
-                    return res_t(std::views::zip(itemFlags_ext, std::get<0>(variant_data)) | std::views::filter(fltr) |
-                                 std::views::transform(transf));
-                }
-                else if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<long long>>) {
-                    return res_t(std::views::zip(itemFlags_ext, std::get<1>(variant_data)) | std::views::filter(fltr) |
-                                 std::views::transform(transf));
-                }
-                else if constexpr (std::same_as<std::remove_cvref_t<decltype(vari)>, std::vector<double>>) {
-                    return res_t(std::views::zip(itemFlags_ext, std::get<2>(variant_data)) | std::views::filter(fltr) |
-                                 std::views::transform(transf));
-                }
-
-                else { static_assert(false); }
-                std::unreachable();
-            };
-
-            return std::visit(visi, variant_data);
+        // Copies the rows at the positions in 'selection' into a vector allocated once at its final size
+        // String cells that are just views get owned
+        template <typename T>
+        static auto gather(std::vector<T> const &vec, std::span<uint32_t const> const selection) {
+            if constexpr (std::same_as<T, std::string_view>) {
+                std::vector<std::string> res;
+                res.reserve(selection.size());
+                for (auto const rowID : selection) { res.emplace_back(vec[rowID]); }
+                return res;
+            }
+            else {
+                std::vector<T> res(selection.size());
+                for (size_t i = 0; i < selection.size(); ++i) { res[i] = vec[selection[i]]; }
+                return res;
+            }
         }
+
+        ownedCol_t get_gatheredData(std::span<uint32_t const> const selection) const {
+            materialize();
+            return std::visit([&](auto const &vari) { return ownedCol_t(gather(vari, selection)); }, m_variantData);
+        }
+
+    private:
+        friend class DataStore;
+
+        // What a lazily parsed column is converted from, 'fieldIndex' is released once it is converted
+        struct LazyState {
+            std::shared_ptr<FieldIndex const> fieldIndex;
+            size_t                            rowCount;
+            std::once_flag                    once;
+            std::atomic<bool>                 done = false;
+        };
+
+        // Encodes the rows that are not yet in the CatDict (string columns only)
+        // Only ever called on a column that is not shared yet or from within the one-time conversion
+        void sync_catDict() const;
+
+        // 'mutable' only so that the one-time conversion can fill them in
+        mutable parsedVal_t            m_colType = parsedVal_t::string_like;
+        mutable Bitmap                 m_itemFlags;
+        mutable varCol_t               m_variantData;
+        mutable std::optional<CatDict> m_catDict = std::nullopt; // Only present for string columns
+        std::unique_ptr<LazyState>     m_lazy    = nullptr;      // Only present for lazily parsed columns
     };
 
-    // DATA MEMBER - THE ONLY ONE
+    // DATA MEMBERS
     std::vector<Column> m_data;
+    // Input buffers (or imported Arrow arrays) that 'zero-copy' string cells point into
+    // Pinned for as long as the DataStore (or its copy) lives
+    std::vector<std::shared_ptr<void const>> m_inputBuffers;
+    // Number of rows of the input when only a sample of them was parsed (see 'ParseOptions::rowBudget')
+    std::optional<size_t> m_sourceRowCount = std::nullopt;
 
     // CONSTRUCTION
     DataStore() : DataStore(DS_CtorObj()) {}
@@ -122,16 +288,30 @@ public:
     bool operator==(const DataStore &other) const { return true; }
 
     // APPENDING
+    // Column promoted into strings by the appended data gets its values so far rendered (see 'promote_varCol')
     void append_data(DS_CtorObj const &vecOfDataVecs);
 
     void append_fakeLabelCol(size_t const sz);
 
+    // PROMOTION
+    // Promotes the column in place, only ever 'widens' it: long long -> double -> string
+    // Already converted values are carried over (not re-parsed), items flagged as null become empty strings
+    // Numbers rendered back into strings need not match their original text (e.g. "1.50" -> "1.5", "007" -> "7")
+    static void promote_varCol(varCol_t &varCol, Bitmap const &itemFlags, parsedVal_t const target);
+    // Same as above, but string cells are sliced out of 'sourceFields' (see 'DS_CtorObj::sourceFields') instead
+    static void promote_varCol(varCol_t &varCol, Bitmap const &itemFlags, parsedVal_t const target,
+                               FieldIndex const &sourceFields);
+    static parsedVal_t get_parsedValType(varCol_t const &varCol);
+    // Converts string_view cells into owned strings (any other column is left as is)
+    static void materialize_strViews(varCol_t &varCol);
+    // Converts lazily parsed columns (see 'DS_CtorObj::fieldIndices') into regular ones
+    static DS_CtorObj materialize_ctorObj(DS_CtorObj const &ctorObj);
+
 
     // VIEWING
-    const auto get_filteredViewOfData(std::vector<size_t> const       &colsToGet,
-                                      std::vector<unsigned int> const &itemFlags_ext) const {
+    const auto get_filteredViewOfData(std::vector<size_t> const &colsToGet, Bitmap const &itemFlags_ext) const {
 
-        using vec_val_t = decltype(Column().get_filteredVariantData(std::vector<unsigned int>()));
+        using vec_val_t = decltype(Column().get_filteredVariantData(Bitmap()));
         std::vector<vec_val_t> res;
 
         for (auto const &oneCol : colsToGet) {
@@ -140,31 +320,41 @@ public:
         return res;
     }
 
-    const auto get_filteredViewOfData(std::vector<size_t> const      &&colsToGet,
-                                      std::vector<unsigned int> const &itemFlags_ext) const {
+    const auto get_filteredViewOfData(std::vector<size_t> const &&colsToGet, Bitmap const &itemFlags_ext) const {
         return get_filteredViewOfData(colsToGet, itemFlags_ext);
     }
 
-    const auto get_filteredViewOfData(std::vector<size_t> const &colsToGet, double const stdDeviation) const {
-        auto flags = compute_filterFlags(colsToGet, stdDeviation);
-        return get_filteredViewOfData(colsToGet, flags);
+    const auto get_filteredViewOfData(size_t const &colToGet, Bitmap const &itemFlags_ext) const {
+        return m_data.at(colToGet).get_filteredVariantData(itemFlags_ext);
     }
-    const auto get_filteredViewOfData(std::vector<size_t> const &&colsToGet, double const stdDeviation) const {
-        return get_filteredViewOfData(colsToGet, stdDeviation);
+    const auto get_filteredViewOfData(size_t const &&colToGet, Bitmap const &itemFlags_ext) const {
+        return get_filteredViewOfData(colToGet, itemFlags_ext);
     }
 
-    const auto get_filteredViewOfData(size_t const &colToGet, std::vector<unsigned int> const &itemFlags_ext) const {
-        return m_data.at(colToGet).get_filteredVariantData(itemFlags_ext);
+    const auto get_selectedViewOfData(size_t const colToGet, std::span<uint32_t const> const selection) const {
+        return m_data.at(colToGet).get_selectedVariantData(selection);
     }
-    const auto get_filteredViewOfData(size_t const &&colToGet, std::vector<unsigned int> const &itemFlags_ext) const {
-        return get_filteredViewOfData(colToGet, itemFlags_ext);
+
+    // Local copies of the rows at the positions in 'selection' (see 'Bitmap::get_selection')
+    ownedCol_t get_gatheredData(size_t const colToGet, std::span<uint32_t const> const selection) const {
+        return m_data.at(colToGet).get_gatheredData(selection);
+    }
+    std::vector<ownedCol_t> get_gatheredData(std::vector<size_t> const    &colsToGet,
+                                             std::span<uint32_t const> const selection) const {
+        std::vector<ownedCol_t> res;
+        res.reserve(colsToGet.size());
+        for (auto const &oneCol : colsToGet) { res.push_back(get_gatheredData(oneCol, selection)); }
+        return res;
     }
 
 
-    std::vector<unsigned int> compute_filterFlags(std::vector<size_t> const  &colsToGet,
-                                                  std::optional<double> const stdDeviation) const;
-    std::vector<unsigned int> compute_filterFlags(std::vector<size_t> const &&colsToGet,
-                                                  std::optional<double> const stdDeviation) const {
+    size_t get_rowCount() const { return m_data.empty() ? 0uz : m_data.front().get_rowCount(); }
+
+    // Null flags of the columns are OR-ed together a word at a time, extreme values are looked for in the rows left
+    FilterFlags compute_filterFlags(std::vector<size_t> const  &colsToGet,
+                                    std::optional<double> const stdDeviation) const;
+    FilterFlags compute_filterFlags(std::vector<size_t> const &&colsToGet,
+                                    std::optional<double> const stdDeviation) const {
         return compute_filterFlags(colsToGet, stdDeviation);
     }
 
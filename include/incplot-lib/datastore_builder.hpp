@@ -0,0 +1,35 @@
+#pragma once
+
+#include <expected>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <incplot-lib/_common.hpp>
+#include <incplot-lib/datastore.hpp>
+#include <incplot-lib/err.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+
+// Builds a DataStore straight out of columns that are already in memory, no text is serialized or parsed on the way
+// Numeric values are bulk copied into the columns (non-finite doubles are flagged as null)
+// Label cells are taken as views, so the strings they point to must outlive the DataStore
+class INCPLOT_LIB_API DataStoreBuilder {
+private:
+    std::vector<DataStore::Column> m_columns;
+
+public:
+    using incerr_c = incerr::incerr_code;
+
+    DataStoreBuilder &add_column(std::string_view const name, std::span<double const> const values);
+    DataStoreBuilder &add_column(std::string_view const name, std::span<long long const> const values);
+    DataStoreBuilder &add_column(std::string_view const name, std::span<std::string_view const> const labels);
+
+    // All the columns must have the same number of rows, they are moved out of the builder into the DataStore
+    std::expected<DataStore, incerr_c> build();
+};
+
+} // namespace terminal_plot
+} // namespace incom
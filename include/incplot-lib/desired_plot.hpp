@@ -35,7 +35,7 @@ private:
 
 
 public:
-    std::vector<unsigned int> filterFlags      = {};
+    DataStore::FilterFlags    filterFlags      = {};
     std::vector<ColumnParams> m_colAssessments = {};
 
 
@@ -250,6 +250,10 @@ public:
     // If impossible to guess or otherwise the user desires something impossible returns Err_plotSpecs.
     std::expected<DesiredPlot, incerr_c> guess_missingParams(DataStore const &ds);
 
+    // Names of the only columns the plot can end up using (the parsers then need not convert any other columns)
+    // Nullopt when some column is specified by ID or is left to be guessed (guessing looks at all the columns)
+    std::optional<std::vector<std::string>> compute_projection() const;
+
 
     // template <typename... PSs>
     // std::expected<DesiredPlot, incerr_c> guess_mostLikely();
@@ -81,6 +81,18 @@ enum class Unexp_parser {
     CSV_valueTypeDoesntMatch,
     CSV_parserBackendError,
     CSV_unhandledCellType,
+    FOLLOW_cannotReadFile,
+    DECOMPRESS_codecNotAvailable,
+    DECOMPRESS_corruptedInput,
+    SNAPSHOT_cannotWriteFile,
+    SNAPSHOT_cannotReadFile,
+    SNAPSHOT_invalidFormat,
+    ARROW_unsupportedFormat,
+    ARROW_invalidArray,
+};
+enum class Unexp_builder {
+    builder_OK,
+    BUILDER_columnSizesDiffer = 1,
 };
 
 enum class Unexp_HTML {
@@ -107,6 +119,7 @@ enum class Unexp_HTML {
 INCERR_REGISTER(incom::terminal_plot::Unexp_plotSpecs, incom::terminal_plot);
 INCERR_REGISTER(incom::terminal_plot::Unexp_plotDrawer, incom::terminal_plot);
 INCERR_REGISTER(incom::terminal_plot::Unexp_parser, incom::terminal_plot);
+INCERR_REGISTER(incom::terminal_plot::Unexp_builder, incom::terminal_plot);
 INCERR_REGISTER(incom::terminal_plot::Unexp_HTML, incom::terminal_plot);
 
 #undef INCERR_REGISTER
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <incplot-lib/_common.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+
+// Read-only raw input data that the parsers run over
+// Either a read-only memory mapping of a file (parsers then work directly on the page cache) or an owned std::string
+// The mapping is pinned for the whole lifetime of the object, move-only so that it is never mapped twice
+// Any string_view obtained from 'get_view()' is valid for as long as the owning InputBuffer is alive
+class INCPLOT_LIB_API InputBuffer {
+private:
+    char const *m_mappedData = nullptr;
+    size_t      m_mappedSize = 0;
+
+    // Only used on Windows (file and file mapping handles), unused elsewhere
+    void *m_fileHandle = nullptr;
+    void *m_mapHandle  = nullptr;
+
+    std::string m_owned;
+
+    void release();
+
+public:
+    InputBuffer() = default;
+    InputBuffer(std::string &&ownedData) : m_owned(std::move(ownedData)) {}
+
+    InputBuffer(InputBuffer const &)            = delete;
+    InputBuffer &operator=(InputBuffer const &) = delete;
+    InputBuffer(InputBuffer &&other) noexcept;
+    InputBuffer &operator=(InputBuffer &&other) noexcept;
+    ~InputBuffer() { release(); }
+
+    std::string_view get_view() const {
+        return m_mappedData != nullptr ? std::string_view(m_mappedData, m_mappedSize) : std::string_view(m_owned);
+    }
+    bool is_mapped() const { return m_mappedData != nullptr; }
+
+    // STATIC
+    // Maps the file read-only
+    // Falls back to reading the file into owned memory when mapping is not possible (empty files, pipes, etc.)
+    static std::optional<InputBuffer> map_file(std::string_view const &path);
+};
+
+} // namespace terminal_plot
+} // namespace incom
@@ -1,7 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <incplot-lib/datastore.hpp>
 #include <incplot-lib/err.hpp>
@@ -21,6 +32,7 @@ using incerr_c = incerr::incerr_code;
 enum class input_t {
     NDJSON,
     JSON,
+    JSON_columnar, // One object of arrays, each array being one column ({"col": [...], ...})
     CSV,
     TSV
 };
@@ -30,44 +42,235 @@ enum class CellType {
     ll_like,
     string_like
 };
+// Type of a column known up front (see 'ParseOptions::schemaHints')
+enum class ColumnHint {
+    double_like,
+    ll_like,
+    string_like,
+    skip // Column is never stored (same as if it wasn't in 'projection')
+};
+
+// Options of one parse call, the defaults result in all of the input being parsed as is
+struct ParseOptions {
+    // Upper bound on the number of rows of the resulting DataStore
+    // Inputs with more rows are sampled by keeping every n-th row, other rows are skipped without being converted
+    // CSV/TSV rows are counted by their newlines (see 'Parser::compute_rowStrides'), newlines inside of quotes included
+    // With quoted fields spanning multiple lines the sample is then smaller than the budget and (as the first row ID
+    // of each chunk follows from the lines counted before it) may differ between parsing on one and multiple threads
+    std::optional<size_t> rowBudget = std::nullopt;
+    // CSV/TSV string cells are views into the input (instead of copies), the input then must outlive the DataStore
+    bool zeroCopyStrings = false;
+    // Names of the only columns to store (in the order of the input), other columns are skipped without being converted
+    std::optional<std::vector<std::string>> projection = std::nullopt;
+    // CSV/TSV columns are only indexed (see 'DataStore::FieldIndex') and get converted on first access
+    // The input then must outlive the DataStore (same as with 'zeroCopyStrings')
+    bool lazyColumns = false;
+    // Types of columns known up front (by column name), hinted columns bypass type inference altogether
+    // Their cells are validated only by converting them into the hinted type (cell that fails to convert is an error)
+    // Columns not hinted are inferred the same as without any hints
+    std::vector<std::pair<std::string, ColumnHint>> schemaHints = {};
+
+    std::optional<ColumnHint> get_schemaHint(std::string_view const colName) const {
+        auto const found = std::ranges::find(schemaHints, colName, &std::pair<std::string, ColumnHint>::first);
+        return found != schemaHints.end() ? std::optional(found->second) : std::nullopt;
+    }
+    bool is_projected(std::string_view const colName) const {
+        if (get_schemaHint(colName) == ColumnHint::skip) { return false; }
+        return not projection.has_value() || std::ranges::find(projection.value(), colName) != projection->end();
+    }
+};
 
 class INCPLOT_LIB_API Parser {
 
     // TYPE ALIAS
     using parser_return_t = std::expected<DataStore::vec_pr_varCol_t, incerr_c>;
 
+public:
+    // Reads at most 'span.size()' bytes of input into the span, returns the number of bytes read
+    // Returning 0 signals the end of input
+    using chunkReader_t = std::function<size_t(std::span<char>)>;
+
+private:
+
+    // Type of one cell together with its already converted value (so that each cell gets converted just once)
+    struct TypedCell {
+        CellType  type   = CellType::null_like;
+        long long llVal  = 0ll;
+        double    dblVal = 0.0;
+    };
+
+    // Columns of one CSV/TSV input as set up from its header and a sample of its first rows
+    // Shared by all the chunks the input is parsed in, so that the result doesn't depend on how it was split
+    struct DelimitedSchema {
+        std::vector<std::string>             colNames;       // All the columns of the header
+        std::vector<size_t>                  projectedIDs;   // Result ID of each column of the header (or npos)
+        std::vector<std::string>             projectedNames; // Names of the projected columns only
+        std::vector<std::optional<CellType>> hintedTypes;    // One per projected column (nullopt if not hinted)
+        std::vector<CellType>                cellTypes;      // Types the projected columns start with
+    };
+
+    // Every 'stride'-th row (counted from the beginning of the whole input) is converted, others are skipped
+    struct RowStride {
+        size_t stride     = 1;
+        size_t firstRowID = 0; // ID of the first row of one chunk within the whole input
+
+        bool is_kept(size_t const rowIDinChunk) const { return (firstRowID + rowIDinChunk) % stride == 0; }
+    };
+
     // HLPRS
     static std::string_view get_trimmedSV(std::string_view const &sv);
 
-    static CellType assess_cellType(auto const &csvCell);
+    static TypedCell assess_typedCell(std::string_view const &rv);
+    // Converts the cell into the hinted type only, nullopt if it can't be converted (empty cells are null_like)
+    static std::optional<TypedCell> convert_hintedCell(std::string_view const &rv, CellType const hinted);
 
-    static double      conv_cellToDouble(auto const &csvCell);
-    static long long   conv_cellToLongLong(auto const &csvCell);
-    static std::string conv_cellToString(auto const &csvCell);
+    // TYPE INFERENCE
+    // Type able to hold values of both types (null_like -> ll_like -> double_like -> string_like)
+    static CellType              widen_cellType(CellType const current, CellType const seen);
+    // Types of the projected columns only, 'projectedIDs' holds the result ID of each input column (or npos)
+    template <char delim>
+    static std::vector<CellType> infer_cellTypes(std::string_view const rows, std::vector<size_t> const &projectedIDs,
+                                                 size_t const projectedCount, size_t const maxRows);
+    // Types are inferred from (at most) 'Config::parser_typeSampleRows' first rows of the whole input
+    template <char delim>
+    static DelimitedSchema infer_delimitedSchema(std::vector<std::string> colNames, std::string_view const rows,
+                                                 ParseOptions const &opts);
 
 
     // COMPOSITION METHODS
     static std::expected<input_t, incerr_c>               assess_inputType(std::string_view const &sv);
+    static bool                                           assess_isColumnarJSON(std::string_view const &sv);
+    static std::optional<input_t>                         assess_inputTypeFromSample(std::string_view const &sv);
+    static std::expected<input_t, incerr_c>               assess_inputTypeFromWhole(std::string_view const &sv);
     static std::expected<DataStore::DS_CtorObj, incerr_c> dispatch_toParsers(input_t const          &inp_t,
-                                                                             std::string_view const &sv);
+                                                                             std::string_view const &sv,
+                                                                             ParseOptions const     &opts = {});
+
+    // PARSE DELIMITED (CSV AND TSV)
+    template <char delim>
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_delimited(std::string_view const trimmed,
+                                                                          ParseOptions const    &opts);
+    static std::vector<std::string_view> split_atRowBoundaries(std::string_view const rows, size_t const maxChunks,
+                                                               bool const quoteAware);
+    template <char delim>
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_delimitedRows(std::string_view const rows,
+                                                                              DelimitedSchema const &schema,
+                                                                              ParseOptions const    &opts,
+                                                                              RowStride const       &rowStride);
+    // Splits header-less data rows into chunks parsed in parallel against the same 'schema'
+    template <char delim>
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_delimitedInParallel(std::string_view const rows,
+                                                                                    DelimitedSchema const &schema,
+                                                                                    ParseOptions const    &opts);
+    // Strides for sampling 'chunks' down to 'rowBudget' rows, there are 'rowsBefore' rows in front of the chunks
+    static std::vector<RowStride> compute_rowStrides(std::vector<std::string_view> const &chunks,
+                                                     size_t const rowBudget, size_t const rowsBefore);
 
-    // PARSE USING RANAV::CSV2
-    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_usingCSV2(auto                 &&csv2Reader,
-                                                                          std::string_view const trimmed);
+    // NDJSON
+    // Parses records against the schema of an already parsed first record
+    // 'schema' holds its (empty) typed columns, 'keys' all of its keys (including those not projected)
+    // There are 'rowsBefore' records in front of 'lines' (for sampling down to 'ParseOptions::rowBudget')
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_NDJSONRecords(std::string_view const          lines,
+                                                                              DataStore::DS_CtorObj const    &schema,
+                                                                              std::vector<std::string> const &keys,
+                                                                              ParseOptions const             &opts,
+                                                                              size_t const rowsBefore);
+
+    // STREAMING
+    // State of parsing one input in consecutive parts (see 'parse_stream' and 'Follower')
+    struct StreamState {
+        std::optional<input_t>   inp_t          = std::nullopt;
+        std::optional<DataStore> res            = std::nullopt;
+        bool                     wholeInputMode = false;
+        // Columns of the first part (CSV/TSV header or keys of the first NDJSON record)
+        // Later parts are parsed against them with the types of the columns parsed so far (nothing is inferred again)
+        std::vector<std::string> colNames;
+    };
+    // Size of the complete rows at the front of 'pending' (0 until there are at least 'minRows' of them)
+    // CSV/TSV rows end only at newlines outside of quotes, so quoted fields spanning multiple lines are never split
+    static size_t get_completeRowsSize(StreamState const &state, std::string_view const pending, size_t const minRows);
+    // Parses one part ('complete' holds complete rows only, the first part starts with the header for CSV/TSV) and
+    // appends it into 'state.res'
+    // Input that can only be parsed whole just switches 'state' into 'wholeInputMode' (nothing gets parsed)
+    static std::expected<void, incerr_c> parse_streamPart(StreamState &state, std::string_view const complete);
+
+    friend class Follower;
 
 
 public:
     // MAIN INTENDED INTERFACE METHOD
     // Dispatches the string_view to the right parser and constructs DataStore
-    static std::expected<DataStore, incerr_c> parse(std::string_view const sv);
+    static std::expected<DataStore, incerr_c> parse(std::string_view const sv, ParseOptions const &opts = {});
+    // Same as above, but CSV/TSV string cells are always views into the input buffer (instead of copies)
+    // The resulting DataStore shares the ownership of the buffer so that the views never dangle
+    static std::expected<DataStore, incerr_c> parse(std::shared_ptr<InputBuffer const> const &inputBuffer,
+                                                    ParseOptions                              opts = {});
+
+    // STREAMING INTERFACE
+    // Reads the input in bounded chunks and parses only complete rows of each chunk, growing the DataStore as it goes
+    // CSV, TSV and NDJSON are parsed chunk by chunk, JSON (or input not recognizable from its first chunk) is collected
+    // whole and then parsed the same as with 'parse'
+    static std::expected<DataStore, incerr_c> parse_stream(chunkReader_t const &reader);
+    static std::expected<DataStore, incerr_c> parse_stream(std::istream &inputStream);
+    static std::expected<DataStore, incerr_c> parse_stream(int const fileDescriptor);
 
     // JSON AND NDJSON
-    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_NDJSON(std::string_view const &trimmed);
-    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_JSON(std::string_view const &trimmed);
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_NDJSON(std::string_view const &trimmed,
+                                                                       ParseOptions const     &opts = {});
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_JSON(std::string_view const &trimmed,
+                                                                     ParseOptions const     &opts = {});
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_JSON_columnar(std::string_view const &trimmed,
+                                                                              ParseOptions const     &opts = {});
 
     // CSV AND TSV
-    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_CSV(std::string_view const sv_like);
-    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_TSV(std::string_view const sv_like);
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_CSV(std::string_view const sv_like,
+                                                                    ParseOptions const    &opts = {});
+    static std::expected<DataStore::DS_CtorObj, incerr_c> parse_TSV(std::string_view const sv_like,
+                                                                    ParseOptions const    &opts = {});
+
+    // LAZY COLUMNS
+    // Converts the fields of one lazily parsed column into its typed values and item flags
+    static std::pair<DataStore::varCol_t, Bitmap> convert_fields(DataStore::FieldIndex const &fieldIndex);
+};
+
+// FOLLOW MODE
+// Follows a growing file (such as a log being appended to) similar to 'tail -f'
+// Remembers how much of the file has already been parsed together with its schema, so that each 'poll' parses only
+// the complete lines appended since the previous one and appends them into the same DataStore
+// JSON (which can't be parsed in parts) is parsed again whole whenever the file grows
+// File which gets smaller than what was already parsed (truncated) or which is replaced by another file at the same
+// path (rotated, identified by its device and inode) is parsed again from the start
+class INCPLOT_LIB_API Follower {
+private:
+    // Identifies the file itself rather than its path (device and inode, volume and file index on Windows)
+    struct FileIdentity {
+        uint64_t device = 0;
+        uint64_t inode  = 0;
+
+        bool operator==(FileIdentity const &other) const = default;
+    };
+
+    std::string                 m_path;
+    size_t                      m_consumedBytes = 0; // Offset of the first byte of the file not parsed yet
+    std::optional<FileIdentity> m_fileIdentity  = std::nullopt; // Of the file the consumed bytes are from
+    Parser::StreamState         m_state;
+
+    // Nullopt when the file can't be inspected (its identity then isn't compared at all)
+    static std::optional<FileIdentity> get_fileIdentity(std::string const &path);
+
+public:
+    explicit Follower(std::string_view const path) : m_path(path) {}
+
+    // Returns the number of rows appended (0 when there are no new complete lines)
+    // Nothing is parsed until the file has at least two complete lines (the header and the first data row for CSV)
+    // Complete lines appended since the previous poll are appended all or none, when any of them can't be parsed the
+    // error is returned and all of them are skipped (the next poll goes on with the lines appended after them)
+    // Error in the first lines of the file (or in JSON) is returned on every poll until the file is fixed or replaced
+    std::expected<size_t, incerr_c> poll();
+
+    // Nullopt until the first rows are parsed
+    std::optional<DataStore> const &get_DS() const { return m_state.res; }
+    size_t                          get_consumedBytes() const { return m_consumedBytes; }
 };
 } // namespace parsers
 } // namespace terminal_plot
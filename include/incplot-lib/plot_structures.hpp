@@ -56,7 +56,7 @@ protected:
     // LEGACY WAY TO ACCESS DATA ... local views into the data held in DataStore
 
     // using vec_val_t =
-    //     decltype(std::declval<DataStore::Column &>().get_filteredVariantData(std::vector<unsigned int>()));
+    //     decltype(std::declval<DataStore::Column &>().get_filteredVariantData(Bitmap()));
 
     // std::optional<vec_val_t> labelTS_dataView = std::nullopt;
     // std::optional<vec_val_t> LOC_cat_dataView     = std::nullopt;
@@ -66,10 +66,12 @@ protected:
     DesiredPlot const &dp;
 
     // NEW WAY TO ACCESS DATA ... local copies of the data in question
-    std::optional<DataStore::varCol_t> labelTS_data = std::nullopt;
-    std::optional<DataStore::varCol_t> cat_data     = std::nullopt;
-    std::vector<DataStore::varCol_t>   values_data;
-    size_t                             data_rowCount = std::numeric_limits<size_t>::max();
+    std::optional<DataStore::ownedCol_t> labelTS_data = std::nullopt;
+    std::optional<DataStore::ownedCol_t> cat_data     = std::nullopt;
+    // Filtered copy of the category column's dictionary (only if the category column is a string column)
+    std::optional<DataStore::CatDict>    cat_dict     = std::nullopt;
+    std::vector<DataStore::ownedCol_t>   values_data;
+    size_t                               data_rowCount = std::numeric_limits<size_t>::max();
 
 public:
     // Descriptors - First thing to be computed.
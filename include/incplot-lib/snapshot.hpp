@@ -0,0 +1,39 @@
+#pragma once
+
+#include <expected>
+#include <memory>
+#include <string_view>
+
+#include <incplot-lib/_common.hpp>
+#include <incplot-lib/datastore.hpp>
+#include <incplot-lib/err.hpp>
+#include <incplot-lib/input_buffer.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+
+// Binary columnar snapshot of a DataStore, so that the same data can be plotted again without parsing any text
+// Header with the schema is followed by one block per column: validity bitmap and then either the raw values
+// (long long or double) or, for string columns, the dictionary (see 'DataStore::CatDict') and the code of each row
+// Loading maps the file, string cells are then views into the mapping (which the DataStore keeps alive)
+// Every other block (numeric values, validity bitmaps, row codes) is bulk copied without any conversion, so a load is
+// still a full copy of the data, it just doesn't parse anything
+// Snapshots are written in the native byte order, loading a snapshot of the other byte order is reported as an error
+namespace snapshot {
+
+using incerr_c = incerr::incerr_code;
+
+// Recognizes a snapshot by the magic bytes at its very beginning
+INCPLOT_LIB_API bool is_snapshot(std::string_view const head);
+
+// Lazily parsed columns get converted before being written
+INCPLOT_LIB_API std::expected<void, incerr_c> save(DataStore const &ds, std::string_view const &path);
+
+INCPLOT_LIB_API std::expected<DataStore, incerr_c> load(std::string_view const &path);
+// The resulting DataStore shares the ownership of the buffer so that its string cells never dangle
+INCPLOT_LIB_API std::expected<DataStore, incerr_c> load(std::shared_ptr<InputBuffer const> const &inputBuffer);
+
+} // namespace snapshot
+} // namespace terminal_plot
+} // namespace incom
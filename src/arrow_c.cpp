@@ -0,0 +1,368 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <incplot-lib/arrow_c.hpp>
+#include <incplot-lib/config.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+namespace arrow_c {
+
+using enum Unexp_parser;
+
+namespace {
+// IMPORT
+// Everything about one child (ie. column) of the imported struct array that is needed to read its rows
+struct ChildView {
+    ArrowSchema const *schema;
+    ArrowArray const  *array;
+    // Position of the first row within the buffers of the child (offset of the parent plus offset of the child)
+    int64_t            first;
+    int64_t            length;
+
+    bool is_valid(int64_t const rowID) const {
+        if (array->null_count == 0 || array->buffers[0] == nullptr) { return true; }
+        auto const  *bits = static_cast<uint8_t const *>(array->buffers[0]);
+        int64_t const pos = first + rowID;
+        return (bits[pos / 8] >> (pos % 8)) & 1;
+    }
+    template <typename T>
+    T get_value(int64_t const rowID) const {
+        T res;
+        std::memcpy(&res, static_cast<std::byte const *>(array->buffers[1]) + (first + rowID) * sizeof(T), sizeof(T));
+        return res;
+    }
+};
+
+Bitmap make_itemFlags(ChildView const &child, Bitmap const &parentFlags) {
+    Bitmap res(parentFlags);
+    if (child.array->null_count == 0 || child.array->buffers[0] == nullptr) { return res; }
+    for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+        if (not child.is_valid(rowID)) { res[rowID] |= 0b1; }
+    }
+    return res;
+}
+
+// Values of the same type as the DataStore uses are copied in bulk, other ones are widened one by one
+// Values in null slots are undefined in Arrow, they are replaced by zeros so that they never leak into the plot
+template <typename SRC, typename TGT>
+std::vector<TGT> import_values(ChildView const &child, Bitmap const &itemFlags) {
+    std::vector<TGT> res(child.length);
+    if constexpr (std::same_as<SRC, TGT>) {
+        if (child.length > 0) {
+            std::memcpy(res.data(), static_cast<std::byte const *>(child.array->buffers[1]) + child.first * sizeof(SRC),
+                        child.length * sizeof(SRC));
+        }
+    }
+    else {
+        for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+            res[rowID] = static_cast<TGT>(child.get_value<SRC>(rowID));
+        }
+    }
+    for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+        if (itemFlags[rowID] & 0b1) { res[rowID] = TGT{}; }
+    }
+    return res;
+}
+
+// Whether all the (non-null) values of an unsigned 64bit column fit into long long
+bool is_inLongLongRange(ChildView const &child, Bitmap const &itemFlags) {
+    for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+        if ((itemFlags[rowID] & 0b1) == 0 &&
+            child.get_value<uint64_t>(rowID) > static_cast<uint64_t>(std::numeric_limits<long long>::max())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<long long> import_booleans(ChildView const &child, Bitmap const &itemFlags) {
+    std::vector<long long> res(child.length);
+    auto const            *bits = static_cast<uint8_t const *>(child.array->buffers[1]);
+    for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+        int64_t const pos = child.first + rowID;
+        res[rowID]        = (itemFlags[rowID] & 0b1) ? 0ll : static_cast<long long>((bits[pos / 8] >> (pos % 8)) & 1);
+    }
+    return res;
+}
+
+// Cells are views into the data buffer of the array, offsets are only checked to be ordered (Arrow does not carry the
+// size of the data buffer)
+template <typename OFFSET>
+std::optional<std::vector<std::string_view>> import_strings(ChildView const &child, Bitmap const &itemFlags) {
+    std::vector<std::string_view> res;
+    res.reserve(child.length);
+    auto const *data = static_cast<char const *>(child.array->buffers[2]);
+    for (int64_t rowID = 0; rowID < child.length; ++rowID) {
+        auto const beg = child.get_value<OFFSET>(rowID);
+        auto const end = child.get_value<OFFSET>(rowID + 1);
+        if (beg < 0 || end < beg || (data == nullptr && end > beg)) { return std::nullopt; }
+        if (itemFlags[rowID] & 0b1) { res.push_back(std::string_view{}); }
+        else { res.push_back(std::string_view(data + beg, static_cast<size_t>(end - beg))); }
+    }
+    return res;
+}
+
+// EXPORT
+// Each exported schema and array owns everything its members point to (including its children)
+// Children are released through their own callbacks, so that a consumer may move them out of their parent
+struct SchemaHolder {
+    std::string                               format;
+    std::string                               name;
+    std::vector<std::unique_ptr<ArrowSchema>> children;
+    std::vector<ArrowSchema *>                childPtrs;
+};
+struct ArrayHolder {
+    std::vector<std::vector<std::byte>>      buffers;
+    std::vector<void const *>                bufferPtrs;
+    std::vector<std::unique_ptr<ArrowArray>> children;
+    std::vector<ArrowArray *>                childPtrs;
+};
+
+void release_schema(ArrowSchema *schema) {
+    auto *holder = static_cast<SchemaHolder *>(schema->private_data);
+    for (auto *child : holder->childPtrs) {
+        if (child->release != nullptr) { child->release(child); }
+    }
+    delete holder;
+    schema->release = nullptr;
+}
+void release_array(ArrowArray *array) {
+    auto *holder = static_cast<ArrayHolder *>(array->private_data);
+    for (auto *child : holder->childPtrs) {
+        if (child->release != nullptr) { child->release(child); }
+    }
+    delete holder;
+    array->release = nullptr;
+}
+
+void fill_schema(ArrowSchema *out, SchemaHolder *holder, int64_t const flags) {
+    *out = ArrowSchema{.format       = holder->format.c_str(),
+                       .name         = holder->name.c_str(),
+                       .metadata     = nullptr,
+                       .flags        = flags,
+                       .n_children   = static_cast<int64_t>(holder->childPtrs.size()),
+                       .children     = holder->childPtrs.empty() ? nullptr : holder->childPtrs.data(),
+                       .dictionary   = nullptr,
+                       .release      = &release_schema,
+                       .private_data = holder};
+}
+void fill_array(ArrowArray *out, ArrayHolder *holder, int64_t const length, int64_t const nullCount) {
+    *out = ArrowArray{.length       = length,
+                      .null_count   = nullCount,
+                      .offset       = 0,
+                      .n_buffers    = static_cast<int64_t>(holder->bufferPtrs.size()),
+                      .n_children   = static_cast<int64_t>(holder->childPtrs.size()),
+                      .buffers      = holder->bufferPtrs.data(),
+                      .children     = holder->childPtrs.empty() ? nullptr : holder->childPtrs.data(),
+                      .dictionary   = nullptr,
+                      .release      = &release_array,
+                      .private_data = holder};
+}
+
+// Buffers are never empty so that their pointers are never null (which Arrow only allows for validity bitmaps)
+void add_buffer(ArrayHolder &holder, void const *data, size_t const size) {
+    auto &buf = holder.buffers.emplace_back(std::max(size, 8uz), std::byte{0});
+    if (size > 0) { std::memcpy(buf.data(), data, size); }
+}
+
+template <typename OFFSET, typename STR>
+void add_stringBuffers(ArrayHolder &holder, std::vector<STR> const &strings) {
+    std::vector<OFFSET> offsets;
+    offsets.reserve(strings.size() + 1);
+    offsets.push_back(0);
+    std::string data;
+    for (auto const &str : strings) {
+        data.append(str);
+        offsets.push_back(static_cast<OFFSET>(data.size()));
+    }
+    add_buffer(holder, offsets.data(), offsets.size() * sizeof(OFFSET));
+    add_buffer(holder, data.data(), data.size());
+}
+} // namespace
+
+
+std::expected<DataStore, incerr_c> from_arrow(ArrowSchema *schema, ArrowArray *array) {
+    if (schema == nullptr || array == nullptr) { return std::unexpected(incerr_c::make(ARROW_invalidArray)); }
+
+    // Both structs are moved out right away so that they get released on every return path
+    // The array is shared with the resulting DataStore only if any of its string cells are referenced
+    std::unique_ptr<ArrowSchema, void (*)(ArrowSchema *)> const ownedSchema(new ArrowSchema(*schema),
+                                                                            [](ArrowSchema *sch) {
+        if (sch->release != nullptr) { sch->release(sch); }
+        delete sch;
+    });
+    std::shared_ptr<ArrowArray> const ownedArray(new ArrowArray(*array), [](ArrowArray *arr) {
+        if (arr->release != nullptr) { arr->release(arr); }
+        delete arr;
+    });
+    schema->release = nullptr;
+    array->release  = nullptr;
+
+    ArrowSchema const &sch = *ownedSchema;
+    ArrowArray const  &arr = *ownedArray;
+    if (sch.release == nullptr || arr.release == nullptr) { return std::unexpected(incerr_c::make(ARROW_invalidArray)); }
+    if (std::string_view(sch.format) != "+s") { return std::unexpected(incerr_c::make(ARROW_unsupportedFormat)); }
+    if (arr.n_children != sch.n_children || arr.length < 0 || arr.offset < 0 || arr.n_buffers < 1 ||
+        arr.buffers == nullptr) {
+        return std::unexpected(incerr_c::make(ARROW_invalidArray));
+    }
+
+    // Rows which are null in the struct itself are null in every column
+    Bitmap parentFlags(arr.length);
+    if (arr.null_count != 0 && arr.buffers[0] != nullptr) {
+        auto const *bits = static_cast<uint8_t const *>(arr.buffers[0]);
+        for (int64_t rowID = 0; rowID < arr.length; ++rowID) {
+            int64_t const pos = arr.offset + rowID;
+            if (((bits[pos / 8] >> (pos % 8)) & 1) == 0) { parentFlags[rowID] = 0b1; }
+        }
+    }
+
+    DataStore res;
+    bool      referencesArray = false;
+    for (int64_t childID = 0; childID < sch.n_children; ++childID) {
+        if (sch.children[childID] == nullptr || arr.children[childID] == nullptr ||
+            arr.children[childID]->buffers == nullptr) {
+            return std::unexpected(incerr_c::make(ARROW_invalidArray));
+        }
+        ChildView const child{.schema = sch.children[childID],
+                              .array  = arr.children[childID],
+                              .first  = arr.offset + arr.children[childID]->offset,
+                              .length = arr.length};
+
+        std::string_view const format(child.schema->format);
+        if (format.size() != 1 || child.schema->dictionary != nullptr) {
+            return std::unexpected(incerr_c::make(ARROW_unsupportedFormat));
+        }
+        int64_t const bufferCount = (format == "u" || format == "U") ? 3 : 2;
+        if (child.array->release == nullptr || child.array->n_buffers != bufferCount ||
+            child.array->length < arr.offset + arr.length || child.array->offset < 0) {
+            return std::unexpected(incerr_c::make(ARROW_invalidArray));
+        }
+        if (child.length > 0 && child.array->buffers[1] == nullptr) {
+            return std::unexpected(incerr_c::make(ARROW_invalidArray));
+        }
+
+        std::string_view const name(child.schema->name == nullptr ? "" : child.schema->name);
+        Bitmap                 itemFlags = make_itemFlags(child, parentFlags);
+        DataStore::varCol_t    data;
+
+        switch (format.front()) {
+            case 'c': data = import_values<int8_t, long long>(child, itemFlags); break;
+            case 'C': data = import_values<uint8_t, long long>(child, itemFlags); break;
+            case 's': data = import_values<int16_t, long long>(child, itemFlags); break;
+            case 'S': data = import_values<uint16_t, long long>(child, itemFlags); break;
+            case 'i': data = import_values<int32_t, long long>(child, itemFlags); break;
+            case 'I': data = import_values<uint32_t, long long>(child, itemFlags); break;
+            case 'l': data = import_values<int64_t, long long>(child, itemFlags); break;
+            case 'L':
+                if (not is_inLongLongRange(child, itemFlags)) {
+                    return std::unexpected(incerr_c::make(ARROW_unsupportedFormat));
+                }
+                data = import_values<uint64_t, long long>(child, itemFlags);
+                break;
+            case 'b': data = import_booleans(child, itemFlags); break;
+            case 'f': data = import_values<float, double>(child, itemFlags); break;
+            case 'g': data = import_values<double, double>(child, itemFlags); break;
+            case 'u':
+            case 'U': {
+                auto strings = format == "u" ? import_strings<int32_t>(child, itemFlags)
+                                             : import_strings<int64_t>(child, itemFlags);
+                if (not strings.has_value()) { return std::unexpected(incerr_c::make(ARROW_invalidArray)); }
+
+                // CatDict of the column gets built when the column is constructed
+                data            = std::move(strings.value());
+                referencesArray = true;
+                break;
+            }
+            default: return std::unexpected(incerr_c::make(ARROW_unsupportedFormat));
+        }
+        std::string colName(name);
+        if (name == "0" || name == "" || name == " ") { colName = Config::noLabel; }
+        res.m_data.push_back(DataStore::Column(std::move(colName), std::move(itemFlags), std::move(data)));
+    }
+
+    // Append 'fake' label column of strings if there is just one val column (the same as the regular constructor)
+    if (res.m_data.size() == 1 && res.m_data.front().get_colType() != parsedVal_t::string_like) {
+        res.append_fakeLabelCol(static_cast<size_t>(arr.length));
+    }
+    if (referencesArray) { res.m_inputBuffers.push_back(ownedArray); }
+    return res;
+}
+
+void to_arrow(DataStore const &ds, ArrowSchema *out_schema, ArrowArray *out_array) {
+    auto *parentSchema   = new SchemaHolder{.format = "+s"};
+    auto *parentArray    = new ArrayHolder{};
+    int64_t const length = static_cast<int64_t>(ds.get_rowCount());
+    parentArray->bufferPtrs.push_back(nullptr);
+
+    for (auto const &col : ds.m_data) {
+        auto *childSchema = new SchemaHolder{.name = col.name};
+        auto *childArray  = new ArrayHolder{};
+
+        // Validity bitmap is left out when there are no nulls at all
+        auto const           &itemFlags = col.get_itemFlags();
+        std::vector<uint8_t>  validity((itemFlags.size() + 7) / 8, 0u);
+        int64_t               nullCount = 0;
+        for (size_t rowID = 0; rowID < itemFlags.size(); ++rowID) {
+            if (itemFlags[rowID] & 0b1) { ++nullCount; }
+            else { validity[rowID / 8] |= static_cast<uint8_t>(1u << (rowID % 8)); }
+        }
+        if (nullCount > 0) { add_buffer(*childArray, validity.data(), validity.size()); }
+
+        auto visi = [&](auto const &colVec) {
+            using val_t = std::remove_cvref_t<decltype(colVec)>::value_type;
+            if constexpr (std::same_as<val_t, long long>) {
+                childSchema->format = "l";
+                add_buffer(*childArray, colVec.data(), colVec.size() * sizeof(val_t));
+            }
+            else if constexpr (std::same_as<val_t, double>) {
+                childSchema->format = "g";
+                add_buffer(*childArray, colVec.data(), colVec.size() * sizeof(val_t));
+            }
+            else {
+                // 32bit offsets unless the data would not fit into them
+                size_t totalSize = 0;
+                for (auto const &str : colVec) { totalSize += str.size(); }
+                if (totalSize <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                    childSchema->format = "u";
+                    add_stringBuffers<int32_t>(*childArray, colVec);
+                }
+                else {
+                    childSchema->format = "U";
+                    add_stringBuffers<int64_t>(*childArray, colVec);
+                }
+            }
+        };
+        std::visit(visi, col.get_variantData());
+
+        for (auto const &buf : childArray->buffers) { childArray->bufferPtrs.push_back(buf.data()); }
+        if (nullCount == 0) { childArray->bufferPtrs.insert(childArray->bufferPtrs.begin(), nullptr); }
+
+        fill_schema(parentSchema->children.emplace_back(std::make_unique<ArrowSchema>()).get(), childSchema,
+                    ARROW_FLAG_NULLABLE);
+        fill_array(parentArray->children.emplace_back(std::make_unique<ArrowArray>()).get(), childArray, length,
+                   nullCount);
+        parentSchema->childPtrs.push_back(parentSchema->children.back().get());
+        parentArray->childPtrs.push_back(parentArray->children.back().get());
+    }
+
+    fill_schema(out_schema, parentSchema, 0);
+    fill_array(out_array, parentArray, length, 0);
+}
+
+} // namespace arrow_c
+} // namespace terminal_plot
+} // namespace incom
@@ -1,9 +1,20 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <format>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <unordered_map>
 
 #include <incplot-lib/config.hpp>
 #include <incplot-lib/datastore.hpp>
+#include <incplot-lib/input_buffer.hpp>
 #include <incplot-lib/parsers_inc.hpp>
+#include <incplot-lib/snapshot.hpp>
+#include <incplot-lib_private/decompress.hpp>
 #include <incstd/incstd_all.hpp>
 #include <utility>
 
@@ -11,100 +22,325 @@
 namespace incom {
 namespace terminal_plot {
 
+namespace {
+constexpr size_t get_promotionRank(parsedVal_t const pv) {
+    switch (pv) {
+        case parsedVal_t::unsigned_like:
+        case parsedVal_t::signed_like:   return 0;
+        case parsedVal_t::double_like:   return 1;
+        case parsedVal_t::string_like:   return 2;
+    }
+    std::unreachable();
+}
+std::string render_asString(auto const &item, unsigned int const itemFlag) {
+    if (itemFlag & 0b1) { return std::string(); }
+    return std::format("{}", item);
+}
+} // namespace
+
 // Data storage for the actual data that are to be plotted
 DataStore::DataStore(DataStore::DS_CtorObj const &ctorObj) {
 
     // Create data descriptors and the structure
-    for (auto const &[colName, dataVect] : ctorObj.data) {
-        DataStore::Column toInsert;
-        if (colName == "0" || colName == "" || colName == " ") { toInsert.name = Config::noLabel; }
-        else { toInsert.name = colName; }
-
-        if (std::holds_alternative<std::vector<std::string>>(dataVect)) {
-            toInsert.colType      = parsedVal_t::string_like;
-            toInsert.variant_data = std::vector<std::string>{};
-        }
-        else if (std::holds_alternative<std::vector<double>>(dataVect)) {
-            toInsert.colType      = parsedVal_t::double_like;
-            toInsert.variant_data = std::vector<double>{};
+    for (size_t id = 0; auto const &[colName, dataVect] : ctorObj.data) {
+        std::string name = (colName == "0" || colName == "" || colName == " ") ? std::string(Config::noLabel) : colName;
+
+        // Types of lazily parsed columns are decided only once they are converted
+        if (not ctorObj.fieldIndices.empty()) {
+            m_data.push_back(Column(std::move(name), std::make_shared<FieldIndex const>(ctorObj.fieldIndices.at(id))));
         }
-        else if (std::holds_alternative<std::vector<long long>>(dataVect)) {
-            toInsert.colType      = parsedVal_t::signed_like;
-            toInsert.variant_data = std::vector<long long>{};
+        else {
+            auto emptyOfSameType = [](auto const &vec) { return varCol_t(std::remove_cvref_t<decltype(vec)>{}); };
+            m_data.push_back(Column(std::move(name), Bitmap(), std::visit(emptyOfSameType, dataVect)));
         }
-        m_data.push_back(std::move(toInsert));
+        ++id;
     }
 
-    append_data(ctorObj);
+    if (ctorObj.fieldIndices.empty()) { append_data(ctorObj); }
+    else { m_sourceRowCount = ctorObj.sourceRowCount; }
+
     // Append 'fake' label column of strings if there is just one val column
     if (m_data.size() == 1) {
-        auto getSize = [&](auto const &vec) -> size_t { return vec.size(); };
-        if (m_data.at(0).colType != parsedVal_t::string_like) {
-            append_fakeLabelCol(std::visit(getSize, ctorObj.data.at(0).second));
-        }
+        if (m_data.at(0).get_colType() != parsedVal_t::string_like) { append_fakeLabelCol(ctorObj.get_rowCount()); }
     }
 }
 
 void DataStore::append_data(DataStore::DS_CtorObj const &ctorObj) {
 
-    if (m_data.size() != ctorObj.data.size()) {
+    // 'Fake' label column (appended at construction when there is just one value column) is extended alongside
+    bool const hasFakeLabelCol = m_data.size() == 2 && ctorObj.data.size() == 1 &&
+                                 m_data.back().name == Config::noLabel &&
+                                 m_data.back().get_colType() == parsedVal_t::string_like &&
+                                 m_data.front().get_colType() != parsedVal_t::string_like;
+
+    if (m_data.size() != ctorObj.data.size() && not hasFakeLabelCol) {
         std::cerr << "Impossible to append data to DataStore.\n";
         std::cerr << "m_data.size in DataStore object = " + std::to_string(m_data.size()) + ".\n" +
                          "vecOfDataVecs.size() = " + std::to_string(ctorObj.data.size()) + ".";
         std::exit(1);
     }
 
-    if (m_data.size() != ctorObj.data.size()) {
-        std::cerr << "Impossible to append data to DataStore.\n";
-        std::cerr << "m_data.size in DataStore object = " + std::to_string(m_data.size()) + ".\n" +
-                         "vecOfDataVecs.size() = " + std::to_string(ctorObj.data.size()) + ".";
-        std::exit(1);
+    // Lazily parsed data are converted right away when appended into existing columns
+    if (not ctorObj.fieldIndices.empty()) { return append_data(materialize_ctorObj(ctorObj)); }
+
+    // Sampled and whole inputs can be mixed, rows that are in full are counted as they are
+    if (m_sourceRowCount.has_value() || ctorObj.sourceRowCount.has_value()) {
+        m_sourceRowCount =
+            m_sourceRowCount.value_or(get_rowCount()) + ctorObj.sourceRowCount.value_or(ctorObj.get_rowCount());
     }
 
-    for (int id = 0; auto &[_, colt_t, flags, data] : m_data) {
-        auto visi = [&](auto &&dataVari) {
-            if (std::holds_alternative<std::remove_cvref_t<decltype(dataVari)>>(ctorObj.data.at(id).second)) {
+    for (size_t id = 0; id < ctorObj.data.size(); ++id) {
+        m_data.at(id).materialize();
+        auto       &colType  = m_data.at(id).m_colType;
+        auto       &flags    = m_data.at(id).m_itemFlags;
+        auto       &data     = m_data.at(id).m_variantData;
+        auto const &toAppend = ctorObj.data.at(id).second;
 
-                for (auto const &item : std::get<std::remove_cvref_t<decltype(dataVari)>>(ctorObj.data.at(id).second)) {
-                    dataVari.push_back(item);
-                }
+        auto const &toAppendFlags       = ctorObj.itemFlags.at(id);
+
+        // Column gets promoted if 'wider' values are being appended into it (long long -> double -> string)
+        if (parsedVal_t const appendType = get_parsedValType(toAppend);
+            get_promotionRank(appendType) > get_promotionRank(colType)) {
+            promote_varCol(data, flags, appendType);
+            colType = appendType;
+        }
+        // Views can only be appended to views, any other string cells get owned
+        if (std::holds_alternative<std::vector<std::string_view>>(data) &&
+            not std::holds_alternative<std::vector<std::string_view>>(toAppend)) {
+            materialize_strViews(data);
+        }
+
+        auto visi = [&](auto &dataVec, auto const &toAppendVec) {
+            using dst_t = std::remove_cvref_t<decltype(dataVec)>::value_type;
+            using src_t = std::remove_cvref_t<decltype(toAppendVec)>::value_type;
+
+            if constexpr (std::same_as<dst_t, src_t>) {
+                for (auto const &item : toAppendVec) { dataVec.push_back(item); }
                 // Once implemented in libc++
-                // dataVari.append_range(std::get<std::remove_cvref_t<decltype(dataVari)>>(ctorObj.data.at(id).second));
+                // dataVec.append_range(toAppendVec);
+            }
+            else if constexpr (std::is_arithmetic_v<dst_t> && std::is_arithmetic_v<src_t>) {
+                for (auto const &item : toAppendVec) { dataVec.push_back(static_cast<dst_t>(item)); }
+            }
+            else if constexpr (std::same_as<dst_t, std::string>) {
+                for (size_t i = 0; auto const &item : toAppendVec) {
+                    dataVec.push_back(render_asString(item, toAppendFlags.at(i++)));
+                }
             }
             else { assert(false); }
         };
-        std::visit(visi, data);
+        std::visit(visi, data, toAppend);
 
-        for (auto const &item : ctorObj.itemFlags.at(id)) { flags.push_back(item); }
-        // Once implemented in libc++
-        // flags.append_range(ctorObj.itemFlags.at(id));
-        ++id;
+        flags.append(toAppendFlags);
+
+        m_data.at(id).sync_catDict();
+    }
+
+    if (hasFakeLabelCol) {
+        size_t const appendedCount = ctorObj.itemFlags.at(0).size();
+        auto        &fakeCol       = m_data.back();
+        std::get<std::vector<std::string>>(fakeCol.m_variantData).resize(fakeCol.m_itemFlags.size() + appendedCount);
+        fakeCol.m_itemFlags.resize(fakeCol.m_itemFlags.size() + appendedCount);
+        fakeCol.sync_catDict();
     }
 }
 
 void DataStore::append_fakeLabelCol(size_t const sz) {
-    m_data.push_back(Column{std::string(Config::noLabel), parsedVal_t::string_like, std::vector(sz, 0u),
-                            std::vector<std::string>(sz, "")});
+    m_data.push_back(Column(std::string(Config::noLabel), Bitmap(sz), std::vector<std::string>(sz, "")));
+}
+
+void DataStore::FieldIndex::append(FieldIndex const &other) {
+    if (other.size() == 0) { return; }
+    if (size() == 0) {
+        *this = other;
+        return;
+    }
+    assert(other.input.data() >= input.data());
+
+    size_t const shift = static_cast<size_t>(other.input.data() - input.data());
+    for (auto const &fieldBeg : other.fieldBegs) { fieldBegs.push_back(shift + fieldBeg); }
+    fieldSizes.insert(fieldSizes.end(), other.fieldSizes.begin(), other.fieldSizes.end());
+    input = std::string_view(input.data(), shift + other.input.size());
+}
+
+DataStore::Column::Column(std::string name, Bitmap itemFlags, varCol_t data, std::optional<CatDict> catDict)
+    : name(std::move(name)), m_colType(get_parsedValType(data)), m_itemFlags(std::move(itemFlags)),
+      m_variantData(std::move(data)), m_catDict(std::move(catDict)) {
+    sync_catDict();
+}
+DataStore::Column::Column(std::string name, std::shared_ptr<FieldIndex const> fieldIndex)
+    : name(std::move(name)), m_lazy(std::make_unique<LazyState>()) {
+    m_lazy->rowCount   = fieldIndex->size();
+    m_lazy->fieldIndex = std::move(fieldIndex);
+}
+
+DataStore::Column::Column(Column const &other) : name(other.name) {
+    other.materialize();
+    m_colType     = other.m_colType;
+    m_itemFlags   = other.m_itemFlags;
+    m_variantData = other.m_variantData;
+    m_catDict     = other.m_catDict;
+}
+DataStore::Column &DataStore::Column::operator=(Column const &other) {
+    if (this != &other) { *this = Column(other); }
+    return *this;
+}
+
+void DataStore::Column::materialize() const {
+    if (is_materialized()) { return; }
+
+    std::call_once(m_lazy->once, [this]() {
+        auto [converted, flags] = parsers::Parser::convert_fields(*m_lazy->fieldIndex);
+        m_variantData           = std::move(converted);
+        m_itemFlags             = std::move(flags);
+        m_colType               = get_parsedValType(m_variantData);
+        sync_catDict();
+        m_lazy->fieldIndex = nullptr;
+        m_lazy->done.store(true, std::memory_order_release);
+    });
+}
+
+void DataStore::Column::sync_catDict() const {
+    if (m_colType != parsedVal_t::string_like) { return; }
+    if (not m_catDict.has_value()) { m_catDict = CatDict{}; }
+
+    auto visi = [&](auto const &strVec) {
+        if constexpr (not std::is_arithmetic_v<typename std::remove_cvref_t<decltype(strVec)>::value_type>) {
+            m_catDict->codes.reserve(strVec.size());
+            for (size_t i = m_catDict->codes.size(); i < strVec.size(); ++i) { m_catDict->push_back(strVec[i]); }
+        }
+    };
+    std::visit(visi, m_variantData);
 }
 
-std::vector<unsigned int> DataStore::compute_filterFlags(std::vector<size_t> const  &colsToGet,
-                                                         std::optional<double> const allowedStdDevitation) const {
+DataStore::DS_CtorObj DataStore::materialize_ctorObj(DS_CtorObj const &ctorObj) {
+    DS_CtorObj res{.data = {}, .itemFlags = {}, .sourceRowCount = ctorObj.sourceRowCount};
+    for (size_t id = 0; id < ctorObj.fieldIndices.size(); ++id) {
+        auto [converted, flags] = parsers::Parser::convert_fields(ctorObj.fieldIndices.at(id));
+        res.data.push_back(std::make_pair(ctorObj.data.at(id).first, std::move(converted)));
+        res.itemFlags.push_back(std::move(flags));
+    }
+    return res;
+}
+
+void DataStore::CatDict::push_back(std::string_view const sv) {
+    auto [it, inserted] = dict.try_emplace(sv, 0uz);
+    it->second++;
+
+    size_t const code = it - dict.begin();
+    assert(code <= std::numeric_limits<uint32_t>::max());
+    codes.push_back(static_cast<uint32_t>(code));
+}
+
+DataStore::CatDict DataStore::CatDict::get_filtered(Bitmap const &itemFlags_ext) const {
+    assert(itemFlags_ext.size() == codes.size());
+    return get_selected(itemFlags_ext.get_selection());
+}
+
+DataStore::CatDict DataStore::CatDict::get_selected(std::span<uint32_t const> const selection) const {
+    CatDict res{.codes = std::vector<uint32_t>(selection.size()), .dict = dict};
+    for (auto &[_, count] : res.dict) { count = 0; }
+    for (size_t i = 0; i < selection.size(); ++i) { res.codes[i] = codes[selection[i]]; }
+    for (auto const code : res.codes) { (res.dict.begin() + code)->second++; }
+    return res;
+}
+
+std::vector<std::string> DataStore::CatDict::get_sortedCategories() const {
+    std::vector<std::string> res;
+    for (auto const &[cat, count] : dict) {
+        if (count > 0) { res.push_back(cat); }
+    }
+    std::ranges::sort(res, std::less());
+    return res;
+}
+
+std::vector<size_t> DataStore::CatDict::get_sortedIDs() const {
+    // Position of each code in the sorted order first, then just a lookup per row
+    std::vector<uint32_t> sortedCodes;
+    for (uint32_t code = 0; code < dict.size(); ++code) {
+        if (get_count(code) > 0) { sortedCodes.push_back(code); }
+    }
+    std::ranges::sort(sortedCodes, std::less(), [&](uint32_t const code) -> std::string const & {
+        return get_category(code);
+    });
+
+    std::vector<size_t> sortedPos(dict.size(), 0uz);
+    for (size_t pos = 0; auto const &code : sortedCodes) { sortedPos[code] = pos++; }
+
+    std::vector<size_t> res;
+    res.reserve(codes.size());
+    for (auto const &code : codes) { res.push_back(sortedPos[code]); }
+    return res;
+}
+
+parsedVal_t DataStore::get_parsedValType(varCol_t const &varCol) {
+    if (std::holds_alternative<std::vector<std::string>>(varCol) ||
+        std::holds_alternative<std::vector<std::string_view>>(varCol)) {
+        return parsedVal_t::string_like;
+    }
+    else if (std::holds_alternative<std::vector<double>>(varCol)) { return parsedVal_t::double_like; }
+    else { return parsedVal_t::signed_like; }
+}
+
+void DataStore::promote_varCol(varCol_t &varCol, Bitmap const &itemFlags, parsedVal_t const target) {
+    if (get_promotionRank(target) <= get_promotionRank(get_parsedValType(varCol))) { return; }
+
+    auto visi = [&](auto const &srcVec) -> varCol_t {
+        using src_t = std::remove_cvref_t<decltype(srcVec)>::value_type;
+
+        if constexpr (not std::is_arithmetic_v<src_t>) { std::unreachable(); }
+        else if (target == parsedVal_t::double_like) { return std::vector<double>(srcVec.begin(), srcVec.end()); }
+        else {
+            std::vector<std::string> res;
+            res.reserve(srcVec.size());
+            for (size_t i = 0; auto const &item : srcVec) { res.push_back(render_asString(item, itemFlags.at(i++))); }
+            return res;
+        }
+    };
+    varCol = std::visit(visi, std::as_const(varCol));
+}
+void DataStore::promote_varCol(varCol_t &varCol, Bitmap const &itemFlags, parsedVal_t const target,
+                               FieldIndex const &sourceFields) {
+    if (target != parsedVal_t::string_like || get_parsedValType(varCol) == parsedVal_t::string_like) {
+        return promote_varCol(varCol, itemFlags, target);
+    }
+    assert(sourceFields.size() == itemFlags.size());
+
+    auto slice_fields = [&]<typename T>() {
+        std::vector<T> res;
+        res.reserve(sourceFields.size());
+        for (size_t rowID = 0; rowID < sourceFields.size(); ++rowID) {
+            res.push_back(T(sourceFields.get_field(rowID)));
+        }
+        return res;
+    };
+    if (sourceFields.zeroCopyStrings) { varCol = slice_fields.template operator()<std::string_view>(); }
+    else { varCol = slice_fields.template operator()<std::string>(); }
+}
+
+void DataStore::materialize_strViews(varCol_t &varCol) {
+    if (auto const *views = std::get_if<std::vector<std::string_view>>(&varCol); views != nullptr) {
+        varCol = std::vector<std::string>(views->begin(), views->end());
+    }
+}
+
+DataStore::FilterFlags DataStore::compute_filterFlags(std::vector<size_t> const  &colsToGet,
+                                                      std::optional<double> const allowedStdDevitation) const {
     if (m_data.size() < 1) { assert(false); }
 
-    std::vector<unsigned int> res(m_data.front().itemFlags.size(), 0u);
+    FilterFlags res{.nulls = Bitmap(get_rowCount()), .outsideStdDev = Bitmap(get_rowCount()), .combined = {}};
 
     // Filter flags for 'null' values based just on the selected columns
     for (auto const &selID : colsToGet) {
         // Non existent column ID or itemFlag sizes do not match
-        if (selID >= m_data.size() || m_data.at(selID).itemFlags.size() != m_data.front().itemFlags.size()) {
-            assert(false);
-        }
-        for (size_t i = 0; auto const &flag : m_data.at(selID).itemFlags) { res[i++] |= flag; }
+        if (selID >= m_data.size() || m_data.at(selID).get_rowCount() != get_rowCount()) { assert(false); }
+        res.nulls |= m_data.at(selID).get_itemFlags();
     }
 
     // Filter based on standard deviation (excluding extreme values)
+    // Statistics of each column are computed over the rows without nulls only
     if (allowedStdDevitation.has_value() && allowedStdDevitation.value() != 0.0) {
-        std::vector<unsigned int> res2(m_data.front().itemFlags.size(), 0u);
+        auto const notNull = res.nulls.get_selection();
         for (auto const &selID : colsToGet) {
 
             auto lam = [&](auto const &varVec) -> void {
@@ -112,32 +348,25 @@ std::vector<unsigned int> DataStore::compute_filterFlags(std::vector<size_t> con
 
                 if constexpr (not std::is_arithmetic_v<v_t>) { return; }
                 else {
+                    auto v = Column::view_selected(varVec, notNull);
 
-                    auto v = std::views::zip(res, varVec) |
-                             std::views::filter([](auto &&tpl) { return std::get<0>(tpl) == 0u; }) |
-                             std::views::transform([](auto &&tpl2) { return std::get<1>(tpl2); });
-
-                    v_t    sum   = 0;
-                    size_t count = 0;
-                    for (auto const &item : v) {
-                        sum += item;
-                        count++;
-                    }
-                    double avg = static_cast<double>(sum) / count;
+                    v_t sum = 0;
+                    for (auto const &item : v) { sum += item; }
+                    double avg = static_cast<double>(sum) / notNull.size();
 
                     auto stddev  = incom::standard::numeric::compute_stdDeviation(v);
                     stddev      *= allowedStdDevitation.value();
-                    for (size_t i = 0; i < res.size(); ++i) {
-                        if (res[i] == 0u) { res2[i] |= (std::abs(varVec[i] - avg) < stddev) ? 0b00 : 0b10; }
+                    for (auto const rowID : notNull) {
+                        if (not(std::abs(varVec[rowID] - avg) < stddev)) { res.outsideStdDev[rowID] = 0b1; }
                     }
                     return;
                 }
             };
 
-            std::visit(lam, m_data.at(selID).variant_data);
+            std::visit(lam, m_data.at(selID).get_variantData());
         }
-        for (size_t i = 0; i < res.size(); ++i) { res[i] |= res2[i]; }
     }
+    res.combined = res.nulls | res.outsideStdDev;
     return res;
 }
 
@@ -145,11 +374,33 @@ std::optional<std::reference_wrapper<const DataStore>> DataStore::get_DS(std::st
     static std::unordered_map<std::string, const DataStore> storageMP;
     if (auto ele = storageMP.find(std::string(sv)); ele != storageMP.end()) { return ele->second; }
     else {
-        auto data_sv = incstd::filesys::get_file_textual(sv);
-        if (not data_sv.has_value()) { return std::nullopt; }
+        auto inputBuffer = InputBuffer::map_file(sv);
+        if (not inputBuffer.has_value()) { return std::nullopt; }
+
+        // With 'zero-copy' strings (or lazy columns) the DataStore itself keeps the (memory mapped) input alive,
+        // otherwise it is released as soon as parsing is done (snapshots are always kept alive, see 'snapshot::load')
+        using parsers::Parser;
+        auto const pinned = std::make_shared<InputBuffer const>(std::move(inputBuffer.value()));
 
-        auto newDS = incom::terminal_plot::parsers::Parser::parse(data_sv.value());
-        if (newDS.has_value()) { return storageMP.insert({std::string(sv), std::move(newDS.value())}).first->second; }
+        // Compressed files are decompressed while being parsed, so neither zero-copy nor lazy columns apply to them
+        auto parse_compressed = [&]() {
+            std::string_view rest = pinned->get_view();
+            return Parser::parse_stream([&](std::span<char> buf) -> size_t {
+                size_t const count = std::min(buf.size(), rest.size());
+                std::ranges::copy(rest.substr(0, count), buf.begin());
+                rest.remove_prefix(count);
+                return count;
+            });
+        };
+        using detail::decompress::Codec;
+        auto newDS = snapshot::is_snapshot(pinned->get_view()) ? snapshot::load(pinned)
+                     : detail::decompress::detect_codec(pinned->get_view()) != Codec::none ? parse_compressed()
+                     : Config::parser_zeroCopyStrings || Config::parser_lazyColumns
+                         ? Parser::parse(pinned, {.lazyColumns = Config::parser_lazyColumns})
+                         : Parser::parse(pinned->get_view());
+        if (newDS.has_value()) {
+            return storageMP.try_emplace(std::string(sv), std::move(newDS.value())).first->second;
+        }
         else { return std::nullopt; }
     };
 }
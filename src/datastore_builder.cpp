@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cmath>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <incplot-lib/config.hpp>
+#include <incplot-lib/datastore_builder.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+
+DataStoreBuilder &DataStoreBuilder::add_column(std::string_view const name, std::span<double const> const values) {
+    Bitmap              itemFlags(values.size());
+    std::vector<double> data(values.begin(), values.end());
+    for (size_t rowID = 0; rowID < data.size(); ++rowID) {
+        if (not std::isfinite(data[rowID])) {
+            itemFlags[rowID] = 0b1;
+            data[rowID]      = 0.0;
+        }
+    }
+    m_columns.push_back(DataStore::Column(std::string(name), std::move(itemFlags), std::move(data)));
+    return *this;
+}
+DataStoreBuilder &DataStoreBuilder::add_column(std::string_view const name, std::span<long long const> const values) {
+    m_columns.push_back(DataStore::Column(std::string(name), Bitmap(values.size()),
+                                          std::vector<long long>(values.begin(), values.end())));
+    return *this;
+}
+DataStoreBuilder &DataStoreBuilder::add_column(std::string_view const                  name,
+                                               std::span<std::string_view const> const labels) {
+    m_columns.push_back(DataStore::Column(std::string(name), Bitmap(labels.size()),
+                                          std::vector<std::string_view>(labels.begin(), labels.end())));
+    return *this;
+}
+
+std::expected<DataStore, incerr::incerr_code> DataStoreBuilder::build() {
+    if (std::ranges::any_of(m_columns, [&](auto const &col) {
+            return col.get_rowCount() != m_columns.front().get_rowCount();
+        })) {
+        return std::unexpected(incerr_c::make(Unexp_builder::BUILDER_columnSizesDiffer));
+    }
+
+    DataStore res;
+    for (auto &col : m_columns) {
+        if (col.name == "0" || col.name == "" || col.name == " ") { col.name = Config::noLabel; }
+        res.m_data.push_back(std::move(col));
+    }
+    m_columns.clear();
+
+    // Append 'fake' label column of strings if there is just one val column (the same as the regular constructor)
+    if (res.m_data.size() == 1 && res.m_data.front().get_colType() != parsedVal_t::string_like) {
+        res.append_fakeLabelCol(res.get_rowCount());
+    }
+    return res;
+}
+
+} // namespace terminal_plot
+} // namespace incom
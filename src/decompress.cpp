@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include <incplot-lib/config.hpp>
+#include <incplot-lib_private/decompress.hpp>
+
+#if defined(INCPLOT_LIB_HAS_ZLIB)
+#include <zlib.h>
+#endif
+#if defined(INCPLOT_LIB_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+
+namespace incom {
+namespace terminal_plot {
+namespace detail {
+namespace decompress {
+
+using enum Unexp_parser;
+
+namespace {
+// Both decompress everything 'read_raw' yields and pass the output to 'emit' chunk by chunk
+// Return false on corrupted or truncated input, stop early (returning true) once 'emit' returns false
+#if defined(INCPLOT_LIB_HAS_ZLIB)
+bool decompress_gzip(auto &&read_raw, auto &&emit) {
+    z_stream strm{};
+    // 15 = maximum window size, +32 = detect gzip (or zlib) header automatically
+    if (inflateInit2(&strm, 15 + 32) != Z_OK) { return false; }
+    auto const inflateGuard = std::unique_ptr<z_stream, decltype(&inflateEnd)>(&strm, &inflateEnd);
+
+    std::string in(Config::parser_streamChunkSize, '\0');
+    bool        inMember   = false; // Between the beginning and the end of one gzip member
+    bool        outputFull = false; // Previous output buffer got filled up, so there might be more pending output
+    while (true) {
+        if (strm.avail_in == 0 && not outputFull) {
+            size_t const readCount = read_raw(std::span<char>(in));
+            if (readCount == 0) { break; }
+            strm.next_in  = reinterpret_cast<Bytef *>(in.data());
+            strm.avail_in = static_cast<uInt>(readCount);
+        }
+
+        std::string out(Config::parser_streamChunkSize, '\0');
+        strm.next_out  = reinterpret_cast<Bytef *>(out.data());
+        strm.avail_out = static_cast<uInt>(out.size());
+
+        int const ret = inflate(&strm, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) { return false; }
+        outputFull = (strm.avail_out == 0);
+        out.resize(out.size() - strm.avail_out);
+
+        // Files concatenated from multiple gzip members are valid too
+        if (ret == Z_STREAM_END) {
+            if (inflateReset(&strm) != Z_OK) { return false; }
+            inMember = false;
+        }
+        else { inMember = true; }
+
+        if (not out.empty() && not emit(std::move(out))) { return true; }
+    }
+    return not inMember;
+}
+#endif
+
+#if defined(INCPLOT_LIB_HAS_ZSTD)
+bool decompress_zstd(auto &&read_raw, auto &&emit) {
+    auto const dctx = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    if (dctx == nullptr) { return false; }
+
+    std::string in(Config::parser_streamChunkSize, '\0');
+    size_t      lastRet = 0; // Non-zero while in the middle of a frame
+    while (true) {
+        size_t const readCount = read_raw(std::span<char>(in));
+        if (readCount == 0) { break; }
+
+        ZSTD_inBuffer input{in.data(), readCount, 0};
+        bool          outputFull = false;
+        while (input.pos < input.size || outputFull) {
+            std::string    out(Config::parser_streamChunkSize, '\0');
+            ZSTD_outBuffer output{out.data(), out.size(), 0};
+
+            lastRet = ZSTD_decompressStream(dctx.get(), &output, &input);
+            if (ZSTD_isError(lastRet)) { return false; }
+            outputFull = (output.pos == output.size);
+            out.resize(output.pos);
+
+            if (not out.empty() && not emit(std::move(out))) { return true; }
+        }
+    }
+    return lastRet == 0;
+}
+#endif
+} // namespace
+
+Codec detect_codec(std::string_view const head) {
+    if (head.starts_with("\x1f\x8b")) { return Codec::gzip; }
+    if (head.starts_with("\x28\xb5\x2f\xfd")) { return Codec::zstd; }
+    return Codec::none;
+}
+
+bool is_codecAvailable(Codec const codec) {
+    switch (codec) {
+        case Codec::none: return true;
+#if defined(INCPLOT_LIB_HAS_ZLIB)
+        case Codec::gzip: return true;
+#endif
+#if defined(INCPLOT_LIB_HAS_ZSTD)
+        case Codec::zstd: return true;
+#endif
+        default: return false;
+    }
+}
+
+TransparentReader::TransparentReader(chunkReader_t rawReader) : m_rawReader(std::move(rawReader)) {
+    // Reader might return fewer bytes than asked for, so it is read until there are enough to recognize the codec
+    m_head.resize(magicSize);
+    size_t headSize = 0;
+    while (headSize < magicSize) {
+        size_t const readCount = m_rawReader(std::span<char>(m_head.data() + headSize, magicSize - headSize));
+        if (readCount == 0) { break; }
+        headSize += readCount;
+    }
+    m_head.resize(headSize);
+
+    m_codec = detect_codec(m_head);
+    if (m_codec == Codec::none) { return; }
+    if (not is_codecAvailable(m_codec)) {
+        m_error        = incerr_c::make(DECOMPRESS_codecNotAvailable);
+        m_producerDone = true;
+        return;
+    }
+    m_producer = std::jthread([this](std::stop_token stopToken) { run_producer(stopToken); });
+}
+
+size_t TransparentReader::read_raw(std::span<char> const buf) {
+    if (m_headConsumed < m_head.size()) {
+        size_t const count = std::min(buf.size(), m_head.size() - m_headConsumed);
+        std::memcpy(buf.data(), m_head.data() + m_headConsumed, count);
+        m_headConsumed += count;
+        return count;
+    }
+    return m_rawReader(buf);
+}
+
+void TransparentReader::run_producer(std::stop_token const stopToken) {
+    [[maybe_unused]] auto read_rawChunk = [&](std::span<char> const buf) { return read_raw(buf); };
+    [[maybe_unused]] auto emit          = [&](std::string &&chunk) { return push_chunk(stopToken, std::move(chunk)); };
+
+    bool succeeded = false;
+#if defined(INCPLOT_LIB_HAS_ZLIB)
+    if (m_codec == Codec::gzip) { succeeded = decompress_gzip(read_rawChunk, emit); }
+#endif
+#if defined(INCPLOT_LIB_HAS_ZSTD)
+    if (m_codec == Codec::zstd) { succeeded = decompress_zstd(read_rawChunk, emit); }
+#endif
+
+    std::scoped_lock lock(m_mutex);
+    if (not succeeded) { m_error = incerr_c::make(DECOMPRESS_corruptedInput); }
+    m_producerDone = true;
+    m_cv.notify_all();
+}
+
+bool TransparentReader::push_chunk(std::stop_token const &stopToken, std::string &&chunk) {
+    std::unique_lock lock(m_mutex);
+    m_cv.wait(lock, stopToken,
+              [&] { return m_ready.size() < std::max(Config::parser_decompressAheadChunks, 1uz); });
+    if (stopToken.stop_requested()) { return false; }
+
+    m_ready.push_back(std::move(chunk));
+    m_cv.notify_all();
+    return true;
+}
+
+size_t TransparentReader::read(std::span<char> const buf) {
+    if (m_codec == Codec::none) { return read_raw(buf); }
+
+    if (m_currentConsumed == m_current.size()) {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [&] { return not m_ready.empty() || m_producerDone; });
+        if (m_ready.empty()) { return 0uz; }
+
+        m_current = std::move(m_ready.front());
+        m_ready.pop_front();
+        m_currentConsumed = 0;
+        m_cv.notify_all();
+    }
+
+    size_t const count = std::min(buf.size(), m_current.size() - m_currentConsumed);
+    std::memcpy(buf.data(), m_current.data() + m_currentConsumed, count);
+    m_currentConsumed += count;
+    return count;
+}
+
+std::optional<incerr_c> TransparentReader::get_error() const {
+    std::scoped_lock lock(m_mutex);
+    return m_error;
+}
+
+} // namespace decompress
+} // namespace detail
+} // namespace terminal_plot
+} // namespace incom
@@ -43,28 +43,32 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::compute_colAssessme
         else { return std::numeric_limits<double>::max(); }
     };
 
-    auto c_catParams = [&](auto const &vecRef) -> void {
+    // Sizes of the individual categories (that is counts of identical values)
+    auto c_catSizes = [&](auto const &vecRef) -> std::vector<size_t> {
         auto vecCpy = vecRef;
 
         std::ranges::sort(vecCpy);
-        auto   view_chunked = std::views::chunk_by(vecCpy, [](auto const &l, auto const &r) { return l == r; });
-        size_t numOfChunks  = std::ranges::count_if(view_chunked, [](auto const &a) { return true; });
+        auto view_chunked = std::views::chunk_by(vecCpy, [](auto const &l, auto const &r) { return l == r; });
+        return std::ranges::to<std::vector>(
+            std::views::transform(view_chunked, [](auto const &chunk) { return std::ranges::size(chunk); }));
+    };
+
+    auto c_catParams = [&](std::vector<size_t> const &catSizes, size_t const rowCount) -> void {
+        size_t numOfChunks = catSizes.size();
 
         // Save category count immediatelly (that is even if the column is not category like later)
         dp.m_colAssessments.back().categoryCount = numOfChunks;
 
         // Are all categories the same size?
-        dp.m_colAssessments.back().is_categoriesSameSize = std::ranges::all_of(
-            view_chunked, [&](auto const &chunk) { return (chunk.size() == view_chunked.front().size()); });
+        dp.m_colAssessments.back().is_categoriesSameSize =
+            std::ranges::all_of(catSizes, [&](auto const &catSize) { return (catSize == catSizes.front()); });
 
         // It is not categoryLike if there are more chunks than half the total num of elements
         // This is kind of arbitrary, but will work to filter out most
         // Also not a category when we have one chunk (that is column of identical values)
-        if ((numOfChunks > (vecCpy.size() / 2)) || numOfChunks == 1) {
-            dp.m_colAssessments.back().is_categoryLike = false;
-        }
+        if ((numOfChunks > (rowCount / 2)) || numOfChunks == 1) { dp.m_colAssessments.back().is_categoryLike = false; }
         // If any chunk has just one element, then it is not category (or the user should clean the data first)
-        else if (std::ranges::any_of(view_chunked, [](auto const &oneChunk) { return oneChunk.size() < 2; })) {
+        else if (std::ranges::any_of(catSizes, [](auto const &catSize) { return catSize < 2; })) {
             dp.m_colAssessments.back().is_categoryLike = false;
         }
         // If passed the above tests, then this could be a category column
@@ -151,13 +155,22 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::compute_colAssessme
     for (auto const &oneCol : ds.m_data) {
         dp.m_colAssessments.push_back({0, false, false, false, false, false, false});
 
-        std::visit(c_catParams, oneCol.variant_data);
-        dp.m_colAssessments.back().standDev                     = std::visit(c_standDev, oneCol.variant_data);
-        dp.m_colAssessments.back().mean                         = std::visit(c_mean, oneCol.variant_data);
-        dp.m_colAssessments.back().is_sameRepeatingSubsequences = std::visit(is_srss, oneCol.variant_data);
-        dp.m_colAssessments.back().is_timeSeriesLikeIndex       = std::visit(is_tsli, oneCol.variant_data);
-        dp.m_colAssessments.back().is_allValuesNonNegative      = std::visit(is_nonNeg, oneCol.variant_data);
-        dp.m_colAssessments.back().is_allValuesIdentical        = std::visit(is_AllTheSame, oneCol.variant_data);
+        // String columns come with dictionary (and so counts) already, no need to sort them
+        if (oneCol.get_catDict().has_value()) {
+            auto const &catDict = oneCol.get_catDict().value();
+            c_catParams(std::ranges::to<std::vector>(std::views::values(catDict.dict.values())),
+                        catDict.codes.size());
+        }
+        else {
+            c_catParams(std::visit(c_catSizes, oneCol.get_variantData()),
+                        std::visit([](auto const &vec) { return vec.size(); }, oneCol.get_variantData()));
+        }
+        dp.m_colAssessments.back().standDev                     = std::visit(c_standDev, oneCol.get_variantData());
+        dp.m_colAssessments.back().mean                         = std::visit(c_mean, oneCol.get_variantData());
+        dp.m_colAssessments.back().is_sameRepeatingSubsequences = std::visit(is_srss, oneCol.get_variantData());
+        dp.m_colAssessments.back().is_timeSeriesLikeIndex       = std::visit(is_tsli, oneCol.get_variantData());
+        dp.m_colAssessments.back().is_allValuesNonNegative      = std::visit(is_nonNeg, oneCol.get_variantData());
+        dp.m_colAssessments.back().is_allValuesIdentical        = std::visit(is_AllTheSame, oneCol.get_variantData());
     }
     return dp;
 }
@@ -228,8 +241,8 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_plotType(Desi
     // Helpers
     size_t useableValCols_count =
         std::ranges::count_if(std::views::zip(ds.m_data, dp.m_colAssessments), [&](auto const &pr) {
-            bool arithmeticCol = std::get<0>(pr).colType == parsedVal_t::signed_like ||
-                                 std::get<0>(pr).colType == parsedVal_t::double_like;
+            bool arithmeticCol = std::get<0>(pr).get_colType() == parsedVal_t::signed_like ||
+                                 std::get<0>(pr).get_colType() == parsedVal_t::double_like;
 
             // Not timeSeriesLike and Not categoryLike
             bool notExcluded = not std::get<1>(pr).is_timeSeriesLikeIndex && not std::get<1>(pr).is_categoryLike;
@@ -246,7 +259,7 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_plotType(Desi
 
     // labelTS_colID was specified
     else if (dp.labelTS_colID.has_value()) {
-        if (ds.m_data.at(dp.labelTS_colID.value()).colType == parsedVal_t::string_like) {
+        if (ds.m_data.at(dp.labelTS_colID.value()).get_colType() == parsedVal_t::string_like) {
             if (dp.values_colIDs.size() < 2) {
                 dp.plot_type_name = incstd::typegen::get_typeIndex<plot_structures::BarV>();
             }
@@ -315,7 +328,7 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_TSCol(Desired
         for (auto const &fvItem : std::views::filter(enumerated, [&](auto const &ca) {
                  return (not std::get<1>(std::get<1>(ca)).is_timeSeriesLikeIndex) &&
                         (dp.cat_colID.has_value() ? std::get<0>(ca) != dp.cat_colID.value() : true) &&
-                        (std::get<0>(std::get<1>(ca)).colType != parsedVal_t::string_like) &&
+                        (std::get<0>(std::get<1>(ca)).get_colType() != parsedVal_t::string_like) &&
                         std::ranges::none_of(dp.values_colIDs, [&](auto const &a) { return a == std::get<0>(ca); });
              })) {
 
@@ -337,8 +350,9 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_TSCol(Desired
                                                 }) |
                           std::ranges::to<std::vector>();
 
-        for (auto const &fvItem : std::views::filter(
-                 enumerated, [](auto const &ct) { return std::get<1>(ct).colType == parsedVal_t::string_like; })) {
+        for (auto const &fvItem : std::views::filter(enumerated, [](auto const &ct) {
+                 return std::get<1>(ct).get_colType() == parsedVal_t::string_like;
+             })) {
             dp.labelTS_colID = std::get<0>(fvItem);
             return dp;
         }
@@ -401,8 +415,8 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_catCol(Desire
 std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_valueCols(DesiredPlot &&dp, DataStore const &ds) {
     auto useableValCols_tpl =
         std::views::filter(std::views::zip(std::views::iota(0), ds.m_data, dp.m_colAssessments), [&](auto const &tpl) {
-            bool arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                 std::get<1>(tpl).colType == parsedVal_t::double_like;
+            bool arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                 std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
 
             // Not timeSeriesLike and Not categoryLike
             bool notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
@@ -570,6 +584,26 @@ std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_missingParams
         .and_then(std::bind_back(DesiredPlot::compute_filterFlags, ds));
 }
 
+std::optional<std::vector<std::string>> DesiredPlot::compute_projection() const {
+    if (labelTS_colID.has_value() || cat_colID.has_value() || not values_colIDs.empty()) { return std::nullopt; }
+    if (not labelTS_colName.has_value() || values_colNames.empty()) { return std::nullopt; }
+
+    // Category column is guessed for scatter plots only (and the plot type might be guessed to be scatter)
+    bool const canBeScatter = not plot_type_name.has_value() ||
+                              plot_type_name.value() == incstd::typegen::get_typeIndex<plot_structures::Scatter>();
+    if (canBeScatter && not cat_colName.has_value()) { return std::nullopt; }
+
+    std::vector<std::string> res{labelTS_colName.value()};
+    res.insert(res.end(), values_colNames.begin(), values_colNames.end());
+    if (cat_colName.has_value()) { res.push_back(cat_colName.value()); }
+    std::ranges::sort(res);
+    res.erase(std::ranges::unique(res).begin(), res.end());
+
+    // Data of just one column would get a 'fake' label column, which is decided from the full data
+    if (res.size() < 2) { return std::nullopt; }
+    return res;
+}
+
 // template <typename... PSs>
 // std::expected<DesiredPlot, incerr::incerr_code> DesiredPlot::guess_mostLikely() {
 //     return std::unexpected(incerr_c::make(GVC_selectYvalColIsUnuseable));
@@ -199,6 +199,32 @@ std::string_view incerr_msg_dispatch(Unexp_parser &&e) {
                    "This error is probably unfixable by the user."sv;
         case Unexp_parser::CSV_unhandledCellType:
             return "Some data element in CSV is neither arithmetic type nor string."sv;
+        case Unexp_parser::FOLLOW_cannotReadFile: return "The followed file cannot be opened or read."sv;
+        case Unexp_parser::DECOMPRESS_codecNotAvailable:
+            return "Input data appear compressed (gzip or zstd). "
+                   "Support for this compression was not available when incplot was built."sv;
+        case Unexp_parser::DECOMPRESS_corruptedInput:
+            return "Compressed input data appear corrupted or truncated."sv;
+        case Unexp_parser::SNAPSHOT_cannotWriteFile: return "The snapshot file cannot be created or written."sv;
+        case Unexp_parser::SNAPSHOT_cannotReadFile:  return "The snapshot file cannot be opened or read."sv;
+        case Unexp_parser::SNAPSHOT_invalidFormat:
+            return "The snapshot file appears corrupted or truncated."
+                   "It might also have been written by a different version of incplot or on a different platform."sv;
+        case Unexp_parser::ARROW_unsupportedFormat:
+            return "Arrow data must be a struct array whose children are integer, floating point, boolean or "
+                   "string arrays. "
+                   "Unsigned 64bit integers must fit into signed 64bit ones."sv;
+        case Unexp_parser::ARROW_invalidArray:
+            return "Arrow array is released already or its buffers do not match its schema."sv;
+
+        default: return "Undocumented error type"sv;
+    }
+}
+
+std::string_view incerr_msg_dispatch(Unexp_builder &&e) {
+    switch (e) {
+        case Unexp_builder::BUILDER_columnSizesDiffer:
+            return "Columns passed to DataStoreBuilder do not all have the same number of rows."sv;
 
         default: return "Undocumented error type"sv;
     }
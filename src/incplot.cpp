@@ -41,8 +41,14 @@ auto _get_vpt_mpNames2Types(DesiredPlot const &dp, DataStore const &ds) {
 // IE: 1) evaluate possibilities, 2) build plotStructure, 3) render into a final string (or render error message)
 std::expected<std::string, incerr_c> make_plot(DesiredPlot &&dp_ctrs, std::string_view inputData) {
     using namespace incom::terminal_plot;
-    auto ds = parsers::Parser::parse(inputData);
+    // Columns the plot can't possibly use are not even converted
+    auto ds = parsers::Parser::parse(inputData, {.projection = dp_ctrs.compute_projection()});
     if (not ds.has_value()) { return std::unexpected(ds.error()); }
+    return make_plot(std::move(dp_ctrs), ds.value());
+}
+
+std::expected<std::string, incerr_c> make_plot(DesiredPlot &&dp_ctrs, DataStore const &ds) {
+    using namespace incom::terminal_plot;
 
     auto lam_buildPAS = [&](auto &&ps_var) {
         auto visi = [&](auto &&ps) -> std::expected<std::string, incerr_c> {
@@ -104,20 +110,20 @@ std::expected<std::string, incerr_c> make_plot(DesiredPlot &&dp_ctrs, std::strin
     // 2) Build the right plot_structure inside a variant
     // 3) Generate plotAsString from the plot_structure variant created in step 2
     if (dp_ctrs.plot_type_name.has_value()) {
-        return evaluate_onePSpossibility(dp_ctrs, ds.value())
-            .and_then(std::bind_back(build_plotStructure, ds.value()))
+        return evaluate_onePSpossibility(dp_ctrs, ds)
+            .and_then(std::bind_back(build_plotStructure, std::cref(ds)))
             .and_then(lam_buildPAS);
     }
     else {
-        return evaluate_allPSpossibilities(dp_ctrs, ds.value())
-            .and_then(std::bind_back(build_plotStructure, ds.value()))
+        return evaluate_allPSpossibilities(dp_ctrs, ds)
+            .and_then(std::bind_back(build_plotStructure, std::cref(ds)))
             .and_then(lam_buildPAS);
     }
     std::unreachable();
 }
 
-std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, std::string_view inputData) {
-    auto res = make_plot(std::forward<decltype(dp_ctrs)>(dp_ctrs), inputData);
+namespace {
+std::string collapse_unExp(std::expected<std::string, incerr_c> const &res) {
     if (res.has_value()) { return res.value(); }
 
     const auto &error  = res.error();
@@ -132,6 +138,14 @@ std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, std::string_view inpu
     }
     return result;
 }
+} // namespace
+
+std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, std::string_view inputData) {
+    return collapse_unExp(make_plot(std::forward<decltype(dp_ctrs)>(dp_ctrs), inputData));
+}
+std::string make_plot_collapseUnExp(DesiredPlot &&dp_ctrs, DataStore const &ds) {
+    return collapse_unExp(make_plot(std::forward<decltype(dp_ctrs)>(dp_ctrs), ds));
+}
 
 // Building plot structure (ie. all the different parts of the plot individually)
 std::expected<var_plotTypes, incerr_c> build_plotStructure(DesiredPlot const &dp, DataStore const &ds) {
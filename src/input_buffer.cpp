@@ -0,0 +1,120 @@
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#include <incplot-lib/input_buffer.hpp>
+#include <incstd/incstd_all.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace incom {
+namespace terminal_plot {
+
+InputBuffer::InputBuffer(InputBuffer &&other) noexcept
+    : m_mappedData(std::exchange(other.m_mappedData, nullptr)), m_mappedSize(std::exchange(other.m_mappedSize, 0)),
+      m_fileHandle(std::exchange(other.m_fileHandle, nullptr)), m_mapHandle(std::exchange(other.m_mapHandle, nullptr)),
+      m_owned(std::move(other.m_owned)) {}
+
+InputBuffer &InputBuffer::operator=(InputBuffer &&other) noexcept {
+    if (this != &other) {
+        release();
+        m_mappedData = std::exchange(other.m_mappedData, nullptr);
+        m_mappedSize = std::exchange(other.m_mappedSize, 0);
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_mapHandle  = std::exchange(other.m_mapHandle, nullptr);
+        m_owned      = std::move(other.m_owned);
+    }
+    return *this;
+}
+
+void InputBuffer::release() {
+    if (m_mappedData != nullptr) {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_mappedData);
+        if (m_mapHandle != nullptr) { CloseHandle(static_cast<HANDLE>(m_mapHandle)); }
+        if (m_fileHandle != nullptr) { CloseHandle(static_cast<HANDLE>(m_fileHandle)); }
+#else
+        ::munmap(const_cast<char *>(m_mappedData), m_mappedSize);
+#endif
+    }
+    m_mappedData = nullptr;
+    m_mappedSize = 0;
+    m_fileHandle = nullptr;
+    m_mapHandle  = nullptr;
+    m_owned.clear();
+}
+
+std::optional<InputBuffer> InputBuffer::map_file(std::string_view const &path) {
+    auto fallback_toOwned = [&]() -> std::optional<InputBuffer> {
+        auto textual = incstd::filesys::get_file_textual(path);
+        if (not textual.has_value()) { return std::nullopt; }
+        return InputBuffer(std::move(textual.value()));
+    };
+
+    InputBuffer res;
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(std::filesystem::path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { return fallback_toOwned(); }
+
+    LARGE_INTEGER fileSize;
+    if (not GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return fallback_toOwned();
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return fallback_toOwned();
+    }
+
+    void const *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return fallback_toOwned();
+    }
+
+    res.m_mappedData = static_cast<char const *>(view);
+    res.m_mappedSize = static_cast<size_t>(fileSize.QuadPart);
+    res.m_fileHandle = file;
+    res.m_mapHandle  = mapping;
+#else
+    std::string const pathStr(path);
+    int               fd = ::open(pathStr.c_str(), O_RDONLY);
+    if (fd < 0) { return fallback_toOwned(); }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || not S_ISREG(st.st_mode) || st.st_size == 0) {
+        ::close(fd);
+        return fallback_toOwned();
+    }
+
+    void *addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (addr == MAP_FAILED) { return fallback_toOwned(); }
+
+    // Parsers go over the input front to back, the hint is purely advisory so the result is ignored
+    ::posix_madvise(addr, static_cast<size_t>(st.st_size), POSIX_MADV_SEQUENTIAL);
+
+    res.m_mappedData = static_cast<char const *>(addr);
+    res.m_mappedSize = static_cast<size_t>(st.st_size);
+#endif
+    return res;
+}
+
+} // namespace terminal_plot
+} // namespace incom
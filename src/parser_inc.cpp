@@ -1,21 +1,50 @@
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cerrno>
 #include <charconv>
+#include <cmath>
+#include <cstdint>
 #include <concepts>
 #include <expected>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <print>
-
 #include <ranges>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
-#include <csv2/reader.hpp>
 #include <nlohmann/json.hpp>
 
+#include <incplot-lib/config.hpp>
 #include <incplot-lib/parsers_inc.hpp>
+#include <incplot-lib_private/csv_tokenizer.hpp>
+#include <incplot-lib_private/decompress.hpp>
+#include <incplot-lib_private/parse_number.hpp>
+#include <incplot-lib_private/simd_scan.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <filesystem>
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace incom {
 namespace terminal_plot {
@@ -32,15 +61,188 @@ static inline bool parse_double(std::string_view sv, double &out) {
     // TODO: Remove this workaround once not needed
 #if defined(__APPLE__) && defined(_LIBCPP_VERSION)
     // libc++ without floating-point from_chars
-    std::string tmp(sv);
-    char       *end = nullptr;
-    out             = std::strtod(tmp.c_str(), &end);
-    return end != tmp.c_str() && *end == '\0';
+    return detail::parse_number::parse_doubleLocaleFree(sv, out);
 #else
     auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), out);
     return ec == std::errc{} && ptr == sv.data() + sv.size();
 #endif
 }
+
+// Type the cells of a hinted column are converted into (nullopt when the column isn't hinted)
+static inline std::optional<CellType> get_hintedCellType(ParseOptions const &opts, std::string_view const colName) {
+    switch (opts.get_schemaHint(colName).value_or(ColumnHint::skip)) {
+        case ColumnHint::double_like: return CellType::double_like;
+        case ColumnHint::ll_like:     return CellType::ll_like;
+        case ColumnHint::string_like: return CellType::string_like;
+        default:                      return std::nullopt;
+    }
+}
+
+// Empty column of the hinted type (nullopt when the column isn't hinted)
+static inline std::optional<DataStore::varCol_t> make_hintedColumn(ParseOptions const    &opts,
+                                                                   std::string_view const colName) {
+    switch (get_hintedCellType(opts, colName).value_or(CellType::null_like)) {
+        case CellType::double_like: return DataStore::varCol_t(std::vector<double>());
+        case CellType::ll_like:     return DataStore::varCol_t(std::vector<long long>());
+        case CellType::string_like: return DataStore::varCol_t(std::vector<std::string>());
+        default:                    return std::nullopt;
+    }
+}
+
+// Whether the number converts into long long exactly
+// Columns hinted as integers reject numbers which would otherwise get truncated (or wrapped around)
+static inline bool is_exactLongLong(double const val) {
+    return std::isfinite(val) && std::trunc(val) == val && val >= -0x1p63 && val < 0x1p63;
+}
+static inline bool is_exactLongLong(uint64_t const val) {
+    return val <= static_cast<uint64_t>(std::numeric_limits<long long>::max());
+}
+static inline bool is_exactLongLong(NLMjson const &val) {
+    if (val.is_number_float()) { return is_exactLongLong(val.template get<double>()); }
+    if (val.is_number_unsigned()) { return is_exactLongLong(val.template get<uint64_t>()); }
+    return true;
+}
+
+// SAX handler for one flat NDJSON record (line) at a time, pushes each value straight into its typed column
+// The first record handled defines the columns (names and types), all the other records are validated against it
+// Values of keys not projected are validated just the same, but are never stored
+class NDJSON_SAXHandler {
+public:
+    // All keys of the schema defining record (in order) and whether each of them is stored as a column
+    struct RecordKeys {
+        std::vector<std::string> names;
+        std::vector<bool>        isProjected;
+    };
+
+private:
+    DataStore::DS_CtorObj  &m_res;
+    RecordKeys             &m_keys;
+    ParseOptions const     &m_opts;
+    bool                    m_definesSchema;
+    size_t                  m_depth = 0;
+    size_t                  m_keyID = 0;
+    size_t                  m_colID = 0;
+    std::string             m_pendingKey;
+    std::optional<incerr_c> m_error = std::nullopt;
+
+    bool fail(Unexp_parser const errCode) {
+        if (not m_error.has_value()) { m_error = incerr_c::make(errCode); }
+        return false;
+    }
+
+    // Types of columns are decided by their hints or (when not hinted) by the first value of the schema defining record
+    // 'fromValue' is nullopt for values which can't decide the type of a column (null, boolean)
+    bool define_column(std::optional<DataStore::varCol_t> &&fromValue) {
+        if (auto hinted = make_hintedColumn(m_opts, m_pendingKey); hinted.has_value()) {
+            fromValue = std::move(hinted);
+        }
+        if (not fromValue.has_value()) { return fail(JSON_unhandledCellType); }
+        if (not m_keys.isProjected.back()) { return true; }
+        m_res.data.push_back(std::make_pair(std::move(m_pendingKey), std::move(fromValue.value())));
+        m_res.itemFlags.push_back({});
+        return true;
+    }
+
+    // Values other than strings are 'compatible' with any numeric column (converted as needed)
+    template <typename T>
+    bool push_value(T const &val, bool const isNullLike) {
+        if (m_depth != 1) { return fail(NDJSON_isNotFlat); }
+        if (m_keyID >= m_keys.names.size()) { return fail(JSON_objectsNotOfSameSize); }
+        size_t const keyID = m_keyID++;
+        if (not m_keys.isProjected[keyID]) { return true; }
+
+        auto visi = [&](auto &colVec) -> bool {
+            using col_t = std::remove_cvref_t<decltype(colVec)>::value_type;
+            // Columns of string views are never defined from JSON (strings in JSON might need unescaping)
+            if constexpr (std::same_as<col_t, std::string_view>) { std::unreachable(); }
+            else if (isNullLike) { colVec.push_back(col_t{}); }
+            else if constexpr (std::same_as<col_t, std::string> != std::same_as<T, std::string>) {
+                return fail(JSON_valueTypeDoesntMatch);
+            }
+            else if constexpr (std::same_as<col_t, std::string>) { colVec.push_back(val); }
+            else if constexpr (std::same_as<col_t, long long> &&
+                               (std::is_floating_point_v<T> || std::is_unsigned_v<T>)) {
+                if (not is_exactLongLong(val) && m_opts.get_schemaHint(m_keys.names[keyID]) == ColumnHint::ll_like) {
+                    return fail(JSON_valueTypeDoesntMatch);
+                }
+                colVec.push_back(static_cast<col_t>(val));
+            }
+            else { colVec.push_back(static_cast<col_t>(val)); }
+            return true;
+        };
+        if (not std::visit(visi, m_res.data[m_colID].second)) { return false; }
+
+        m_res.itemFlags[m_colID++].push_back(isNullLike ? 0b1 : 0b0);
+        return true;
+    }
+
+public:
+    NDJSON_SAXHandler(DataStore::DS_CtorObj &res, RecordKeys &keys, ParseOptions const &opts,
+                      bool const definesSchema)
+        : m_res(res), m_keys(keys), m_opts(opts), m_definesSchema(definesSchema) {}
+
+    std::optional<incerr_c> const &get_error() const { return m_error; }
+
+    // JSON SAX INTERFACE
+    bool null() {
+        if (m_definesSchema && not(m_depth == 1 && define_column(std::nullopt))) {
+            return fail(JSON_unhandledCellType);
+        }
+        return push_value(0ll, true);
+    }
+    bool boolean(bool val) {
+        if (m_definesSchema && not(m_depth == 1 && define_column(std::nullopt))) {
+            return fail(JSON_unhandledCellType);
+        }
+        return push_value(static_cast<long long>(val), false);
+    }
+    bool number_integer(NLMjson::number_integer_t val) {
+        if (m_definesSchema && m_depth == 1 && not define_column(std::vector<long long>())) { return false; }
+        return push_value(val, false);
+    }
+    bool number_unsigned(NLMjson::number_unsigned_t val) {
+        if (m_definesSchema && m_depth == 1 && not define_column(std::vector<long long>())) { return false; }
+        return push_value(val, false);
+    }
+    bool number_float(NLMjson::number_float_t val, NLMjson::string_t const &) {
+        if (m_definesSchema && m_depth == 1 && not define_column(std::vector<double>())) { return false; }
+        return push_value(val, false);
+    }
+    bool string(NLMjson::string_t &val) {
+        if (m_definesSchema && m_depth == 1 && not define_column(std::vector<std::string>())) { return false; }
+        return push_value(val, val.empty());
+    }
+    bool binary(NLMjson::binary_t &) { return fail(JSON_unhandledCellType); }
+
+    bool start_object(size_t) {
+        if (++m_depth > 1) { return fail(NDJSON_isNotFlat); }
+        m_keyID = 0;
+        m_colID = 0;
+        return true;
+    }
+    bool key(NLMjson::string_t &val) {
+        if (m_definesSchema) {
+            m_keys.names.push_back(val);
+            m_keys.isProjected.push_back(m_opts.is_projected(val));
+            m_pendingKey = val;
+        }
+        else if (m_keyID >= m_keys.names.size()) { return fail(JSON_objectsNotOfSameSize); }
+        else if (val != m_keys.names[m_keyID]) { return fail(JSON_keyNameDoesntMatch); }
+        return true;
+    }
+    bool end_object() {
+        --m_depth;
+        if (m_keyID != m_keys.names.size()) { return fail(JSON_objectsNotOfSameSize); }
+        m_definesSchema = false;
+        return true;
+    }
+    bool start_array(size_t) { return fail(NDJSON_isNotFlat); }
+    bool end_array() { return fail(NDJSON_isNotFlat); }
+
+    bool parse_error(size_t, std::string const &, nlohmann::detail::exception const &) {
+        return fail(JSON_parserBackendError);
+    }
+};
 } // namespace
 
 static bool validate_jsonSameness(NLMjson const &json_A, NLMjson const &json_B) {
@@ -56,6 +258,151 @@ static bool validate_jsonSameness(NLMjson const &json_A, NLMjson const &json_B)
     return true;
 }
 
+// Validates that data parsed from a later chunk of streamed input can be appended to what was parsed before
+// Long long and double columns are compatible (DataStore::append_data promotes as needed)
+// For CSV and TSV string columns are compatible too (promoted the same as when parsing whole input)
+static std::expected<void, incerr_c> validate_appendable(DataStore const &ds, DataStore::DS_CtorObj const &ctorObj,
+                                                         input_t const inp_t) {
+    bool const isDelimited = inp_t == input_t::CSV || inp_t == input_t::TSV;
+    // DataStore with just one value column also contains 'fake' label column
+    if (ctorObj.data.size() > ds.m_data.size()) {
+        return std::unexpected(
+            incerr_c::make(isDelimited ? CSV_headerHasLessItemsThanDataRow : JSON_objectsNotOfSameSize));
+    }
+    if (ctorObj.data.size() + 1 < ds.m_data.size()) {
+        return std::unexpected(
+            incerr_c::make(isDelimited ? CSV_headerHasMoreItemsThanDataRow : JSON_objectsNotOfSameSize));
+    }
+    for (size_t i = 0; auto const &[colName, colVar] : ctorObj.data) {
+        auto const &dsCol = ds.m_data.at(i++);
+        if (dsCol.name != colName && dsCol.name != Config::noLabel) {
+            return std::unexpected(incerr_c::make(JSON_keyNameDoesntMatch));
+        }
+        if (isDelimited) { continue; }
+        if ((dsCol.get_colType() == parsedVal_t::string_like) !=
+            (DataStore::get_parsedValType(colVar) == parsedVal_t::string_like)) {
+            return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+        }
+    }
+    return {};
+}
+
+// Appends column fragment parsed from a later chunk, types of the columns are unified by promoting the 'narrower' one
+static void append_fragment(DataStore::DS_CtorObj &into, DataStore::DS_CtorObj &&fragment) {
+    if (into.sourceRowCount.has_value() || fragment.sourceRowCount.has_value()) {
+        into.sourceRowCount = into.sourceRowCount.value_or(into.get_rowCount()) +
+                              fragment.sourceRowCount.value_or(fragment.get_rowCount());
+    }
+    // Lazily parsed fragments are just indices into consecutive parts of the same input
+    if (not into.fieldIndices.empty()) {
+        for (auto &&[intoIndex, fragIndex] : std::views::zip(into.fieldIndices, fragment.fieldIndices)) {
+            intoIndex.append(fragIndex);
+        }
+        return;
+    }
+    // Columns promoted into strings keep the text of their cells when it is known (see 'DS_CtorObj::sourceFields')
+    auto promote = [](DataStore::DS_CtorObj &ctorObj, size_t const colID, parsedVal_t const target) {
+        if (ctorObj.sourceFields.empty()) {
+            DataStore::promote_varCol(ctorObj.data[colID].second, ctorObj.itemFlags[colID], target);
+        }
+        else {
+            DataStore::promote_varCol(ctorObj.data[colID].second, ctorObj.itemFlags[colID], target,
+                                      ctorObj.sourceFields[colID]);
+        }
+    };
+    for (size_t i = 0; i < into.data.size(); ++i) {
+        auto &intoCol = into.data[i].second;
+        auto &fragCol = fragment.data.at(i).second;
+        promote(into, i, DataStore::get_parsedValType(fragCol));
+        promote(fragment, i, DataStore::get_parsedValType(intoCol));
+        // Owned and viewed string cells are unified by owning all of them
+        if (intoCol.index() != fragCol.index()) {
+            DataStore::materialize_strViews(intoCol);
+            DataStore::materialize_strViews(fragCol);
+        }
+
+        auto visi = [&](auto &intoVec) {
+            auto &fragVec = std::get<std::remove_cvref_t<decltype(intoVec)>>(fragCol);
+            intoVec.insert(intoVec.end(), std::make_move_iterator(fragVec.begin()),
+                           std::make_move_iterator(fragVec.end()));
+        };
+        std::visit(visi, intoCol);
+        into.itemFlags[i].append(fragment.itemFlags.at(i));
+
+        if (into.sourceFields.empty()) { continue; }
+        if (DataStore::get_parsedValType(intoCol) == parsedVal_t::string_like) {
+            into.sourceFields[i] = DataStore::FieldIndex{};
+        }
+        else { into.sourceFields[i].append(fragment.sourceFields.at(i)); }
+    }
+}
+
+// Number of chunks to split input of 'inputSize' bytes into for parallel parsing
+static size_t get_parallelChunkCount(size_t const inputSize) {
+    size_t const threadCount = Config::parser_threadCount != 0
+                                   ? Config::parser_threadCount
+                                   : std::max(static_cast<size_t>(std::thread::hardware_concurrency()), 1uz);
+    return std::clamp(inputSize / std::max(Config::parser_parallelMinChunkSize, 1uz), 1uz, threadCount);
+}
+
+// Parses each chunk into a fragment (the first chunk on the calling thread, the others on worker threads)
+// Fragments are then concatenated in order, the first error (in order of chunks) is returned
+// 'parse_oneChunk' is called with the chunk and its ID
+static std::expected<DataStore::DS_CtorObj, incerr_c> parse_chunksInParallel(
+    std::vector<std::string_view> const &chunks, auto const &parse_oneChunk) {
+    std::vector<std::expected<DataStore::DS_CtorObj, incerr_c>> fragments(chunks.size());
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks.size() - 1);
+        for (size_t i = 1; i < chunks.size(); ++i) {
+            workers.emplace_back([&, i]() { fragments[i] = parse_oneChunk(chunks[i], i); });
+        }
+        fragments.front() = parse_oneChunk(chunks.front(), 0uz);
+    }
+
+    for (auto &fragment : fragments) {
+        if (not fragment.has_value()) { return std::unexpected(fragment.error()); }
+    }
+    for (auto &fragment : std::views::drop(fragments, 1)) {
+        append_fragment(fragments.front().value(), std::move(fragment.value()));
+    }
+    return std::move(fragments.front());
+}
+
+// Every n-th row is kept so that there are at most 'rowBudget' rows out of 'rowCount'
+static size_t get_rowStride(size_t const rowCount, size_t const rowBudget) {
+    size_t const budget = std::max(rowBudget, 1uz);
+    return rowCount > budget ? (rowCount + budget - 1) / budget : 1uz;
+}
+
+// Samples already parsed rows down to the row budget (for inputs that can't skip rows while being parsed)
+static DataStore::DS_CtorObj decimate_toRowBudget(DataStore::DS_CtorObj     &&ctorObj,
+                                                  std::optional<size_t> const rowBudget) {
+    size_t const rowCount = ctorObj.get_rowCount();
+    if (not rowBudget.has_value() || get_rowStride(rowCount, rowBudget.value()) == 1) { return std::move(ctorObj); }
+    size_t const stride = get_rowStride(rowCount, rowBudget.value());
+
+    auto decimate = [&](auto &vec) {
+        size_t kept = 0;
+        for (size_t rowID = 0; rowID < vec.size(); rowID += stride) { vec[kept++] = std::move(vec[rowID]); }
+        vec.resize(kept);
+    };
+    for (auto &[_, colVar] : ctorObj.data) { std::visit(decimate, colVar); }
+    for (auto &flags : ctorObj.itemFlags) { decimate(flags); }
+    ctorObj.sourceRowCount = rowCount;
+    return std::move(ctorObj);
+}
+
+// Names of the columns of CSV/TSV input
+template <char delim>
+static std::vector<std::string> tokenize_header(std::string_view const header) {
+    std::vector<std::string> res;
+    detail::csv_tokenizer::tokenize<delim>(
+        header, [&](size_t, std::string_view const field) { res.push_back(std::string(field)); },
+        [](size_t) { return false; });
+    return res;
+}
+
 static bool validate_jsonSameness(std::vector<NLMjson> const &jsonVec) {
     // Validate that all the JSON objects parsed above have the same structure
     for (auto const &js : std::views::drop(jsonVec, 1)) {
@@ -75,62 +422,183 @@ std::string_view Parser::get_trimmedSV(std::string_view const &sv) {
 }
 
 
-CellType Parser::assess_cellType(auto const &csvCell) {
-    std::string_view rv = csvCell.read_view();
-    if (rv.empty()) { return CellType::null_like; }
-
-    long long llOut = 0ll;
-    auto [ptr, _]   = std::from_chars(rv.data(), rv.data() + rv.size(), llOut);
+// Classifies the cell and converts it in one go
+// Integers that don't fit into long long are treated as double
+Parser::TypedCell Parser::assess_typedCell(std::string_view const &rv) {
+    if (rv.empty()) { return TypedCell{}; }
 
-    if (ptr == (rv.data() + rv.size())) { return CellType::ll_like; }
+    TypedCell res;
+    auto [ptr, ec] = std::from_chars(rv.data(), rv.data() + rv.size(), res.llVal);
+    if (ec == std::errc{} && ptr == (rv.data() + rv.size())) {
+        res.type = CellType::ll_like;
+        return res;
+    }
 
-    double dblOut = 0.0;
-    if (parse_double(rv, dblOut)) { return CellType::double_like; }
+    if (parse_double(rv, res.dblVal)) {
+        res.type = CellType::double_like;
+        return res;
+    }
 
-    return CellType::string_like;
+    res.type = CellType::string_like;
+    return res;
 }
 
-double Parser::conv_cellToDouble(auto const &csvCell) {
-    std::string_view rv  = csvCell.read_view();
-    double           res = 0.0;
+// No probing of other types, the cell is just converted into the hinted one
+std::optional<Parser::TypedCell> Parser::convert_hintedCell(std::string_view const &rv, CellType const hinted) {
+    if (rv.empty()) { return TypedCell{}; }
 
-    auto ok = parse_double(rv, res);
-
-    if (ok) { return res; }
-    else {
-        std::print("{}\n{}{}\n", "Error in conv_cellToDouble, not convertable to double",
-                   "Encountered while parsing: ", rv);
-        std::exit(1);
+    TypedCell res{.type = hinted};
+    if (hinted == CellType::ll_like) {
+        auto [ptr, ec] = std::from_chars(rv.data(), rv.data() + rv.size(), res.llVal);
+        if (ec != std::errc{} || ptr != (rv.data() + rv.size())) { return std::nullopt; }
     }
-    std::unreachable();
+    else if (hinted == CellType::double_like) {
+        if (not parse_double(rv, res.dblVal)) { return std::nullopt; }
+    }
+    return res;
 }
-long long Parser::conv_cellToLongLong(auto const &csvCell) {
-    std::string_view rv  = csvCell.read_view();
-    long long        res = 0.0;
 
-    auto [ptr, ec] = std::from_chars(rv.data(), rv.data() + rv.size(), res);
+CellType Parser::widen_cellType(CellType const current, CellType const seen) {
+    if (current == CellType::string_like || seen == CellType::string_like) { return CellType::string_like; }
+    if (current == CellType::double_like || seen == CellType::double_like) { return CellType::double_like; }
+    if (current == CellType::ll_like || seen == CellType::ll_like) { return CellType::ll_like; }
+    return CellType::null_like;
+}
 
-    if (ec == std::errc()) { return res; }
-    else if (ec == std::errc::invalid_argument) {
-        std::print("{}\n{}{}\n", "Error in conv_cellToLongLong, not convertable to long long",
-                   "Encountered while parsing: ", rv);
-        std::exit(1);
+// Cheap pre-pass over (at most) 'maxRows' first data rows, only assesses the types of cells
+template <char delim>
+std::vector<CellType> Parser::infer_cellTypes(std::string_view const rows, std::vector<size_t> const &projectedIDs,
+                                              size_t const projectedCount, size_t const maxRows) {
+    std::vector<CellType> res(projectedCount, CellType::null_like);
+    if (maxRows == 0) { return res; }
+
+    size_t rowCount = 0;
+    auto   on_field = [&](size_t const colID, std::string_view const field) {
+        if (colID >= projectedIDs.size() || projectedIDs[colID] == std::string_view::npos) { return; }
+        size_t const resID = projectedIDs[colID];
+        res[resID]         = widen_cellType(res[resID], assess_typedCell(field).type);
+    };
+    detail::csv_tokenizer::tokenize<delim>(rows, on_field, [&](size_t) { return ++rowCount < maxRows; });
+    return res;
+}
+
+// Fields of columns not projected are tokenized (so that rows are still validated), but never converted
+// Hinted columns are left out of type inference altogether
+template <char delim>
+Parser::DelimitedSchema Parser::infer_delimitedSchema(std::vector<std::string> colNames, std::string_view const rows,
+                                                      ParseOptions const &opts) {
+    DelimitedSchema     res{.colNames = std::move(colNames)};
+    std::vector<size_t> inferredIDs; // Same as 'projectedIDs', but npos for hinted columns
+    for (auto const &colName : res.colNames) {
+        if (opts.is_projected(colName)) {
+            res.hintedTypes.push_back(get_hintedCellType(opts, colName));
+            res.projectedIDs.push_back(res.projectedNames.size());
+            inferredIDs.push_back(res.hintedTypes.back().has_value() ? std::string_view::npos
+                                                                     : res.projectedNames.size());
+            res.projectedNames.push_back(colName);
+        }
+        else {
+            res.projectedIDs.push_back(std::string_view::npos);
+            inferredIDs.push_back(std::string_view::npos);
+        }
     }
-    else if (ec == std::errc::result_out_of_range) {
-        std::print("{}\n{}{}\n", "Error in conv_cellToLongLong, range error in std::from_chars",
-                   "Encountered while parsing: ", rv);
-        std::exit(1);
+    bool const allHinted = std::ranges::all_of(res.hintedTypes, [](auto const &hinted) { return hinted.has_value(); });
+
+    // Lazily parsed columns are only indexed, their types are inferred once they are converted
+    res.cellTypes = infer_cellTypes<delim>(rows, inferredIDs, res.projectedNames.size(),
+                                           (opts.lazyColumns || allHinted) ? 0uz : Config::parser_typeSampleRows);
+    for (auto const &[cellType, hinted] : std::views::zip(res.cellTypes, res.hintedTypes)) {
+        if (hinted.has_value()) { cellType = hinted.value(); }
     }
-    else { assert(false); }
-    std::unreachable();
-}
-std::string Parser::conv_cellToString(auto const &csvCell) {
-    return std::string(csvCell.read_view());
+    return res;
 }
 
 
 // COMPOSITION METHODS
+// Large inputs are first assessed from a bounded sample at the beginning and at the end only
+// Input is scanned whole only when the sample is ambiguous (or the input is small anyway)
 std::expected<input_t, incerr_c> Parser::assess_inputType(std::string_view const &sv) {
+    // Columnar JSON is recognizable from its very beginning
+    if (assess_isColumnarJSON(sv)) { return input_t::JSON_columnar; }
+    if (sv.size() > 2 * Config::parser_detectSampleSize) {
+        if (auto const sampled = assess_inputTypeFromSample(sv); sampled.has_value()) { return sampled.value(); }
+    }
+    return assess_inputTypeFromWhole(sv);
+}
+
+// One top level object (and nothing else) whose first value is an array
+bool Parser::assess_isColumnarJSON(std::string_view const &sv) {
+    if (not sv.starts_with('{') || not sv.ends_with('}')) { return false; }
+
+    auto const isWhiteSpace = [](char const chr) { return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r'; };
+    auto       afterBrace   = std::views::drop(sv, 1) | std::views::drop_while(isWhiteSpace);
+    if (afterBrace.empty() || afterBrace.front() != '"') { return false; }
+
+    // Skipping over the first key (which might contain escaped quotes)
+    size_t pos = sv.size() - std::ranges::distance(afterBrace) + 1;
+    for (; pos < sv.size() && sv[pos] != '"'; ++pos) {
+        if (sv[pos] == '\\') { ++pos; }
+    }
+    auto afterKey = std::views::drop(sv, pos + 1) | std::views::drop_while(isWhiteSpace);
+    if (afterKey.empty() || afterKey.front() != ':') { return false; }
+
+    auto afterColon = std::views::drop(afterKey, 1) | std::views::drop_while(isWhiteSpace);
+    if (afterColon.empty() || afterColon.front() != '[') { return false; }
+
+    // The object must also be the whole input (NDJSON whose first record holds an array is not columnar)
+    size_t depth    = 0;
+    bool   inString = false;
+    for (size_t i = 0; i < sv.size(); ++i) {
+        if (inString) {
+            if (sv[i] == '\\') { ++i; }
+            else if (sv[i] == '"') { inString = false; }
+        }
+        else if (sv[i] == '"') { inString = true; }
+        else if (sv[i] == '{' || sv[i] == '[') { ++depth; }
+        else if ((sv[i] == '}' || sv[i] == ']') && --depth == 0) { return i + 1 == sv.size(); }
+    }
+    return false;
+}
+
+std::optional<input_t> Parser::assess_inputTypeFromSample(std::string_view const &sv) {
+    if (sv.front() == '[') {
+        if (sv.back() == ']') { return input_t::JSON; }
+        return std::nullopt;
+    }
+
+    // Only complete lines from the sample are considered
+    std::string_view prefix = sv.substr(0, Config::parser_detectSampleSize);
+    std::string_view suffix = sv.substr(sv.size() - Config::parser_detectSampleSize);
+    size_t const     prefEnd = prefix.rfind('\n');
+    size_t const     sufBeg  = suffix.find('\n');
+    if (prefEnd == std::string_view::npos || sufBeg == std::string_view::npos) { return std::nullopt; }
+    prefix = prefix.substr(0, prefEnd);
+    suffix = suffix.substr(sufBeg + 1);
+
+    // '{', '}', ',', '\t' ... every sampled line must contain the same count of each
+    std::optional<std::array<size_t, 4>> lineCounts = std::nullopt;
+    bool                                 ndjsonLike = true;
+    for (auto const part : {prefix, suffix}) {
+        for (auto const oneLine :
+             std::views::split(part, '\n') | std::views::transform([](auto const &in) { return std::string_view(in); })) {
+            auto const counts = detail::simd_scan::count_bytes<'{', '}', ',', '\t'>(oneLine);
+            if (not lineCounts.has_value()) { lineCounts = counts; }
+            else if (counts != lineCounts.value()) { return std::nullopt; }
+            ndjsonLike = ndjsonLike && oneLine.starts_with('{') && oneLine.ends_with('}');
+        }
+    }
+    if (not lineCounts.has_value()) { return std::nullopt; }
+
+    auto const [begBrcCount, endBrcCount, commaCount, tabCount] = lineCounts.value();
+    if (sv.front() == '{') {
+        if (ndjsonLike && begBrcCount == 1 && endBrcCount == 1) { return input_t::NDJSON; }
+    }
+    else if (commaCount != 0) { return input_t::CSV; }
+    else if (tabCount != 0) { return input_t::TSV; }
+    return std::nullopt;
+}
+
+std::expected<input_t, incerr_c> Parser::assess_inputTypeFromWhole(std::string_view const &sv) {
     size_t begBrcCount = 0, endBrcCount = 0;
 
     for (auto it : sv) {
@@ -142,18 +610,8 @@ std::expected<input_t, incerr_c> Parser::assess_inputType(std::string_view const
         else { break; }
     }
 
-    std::tuple arr(1, 2, 3, 4, 5);
-
     // '{', '}', '\n', ',', '\t'
-    auto count_symbols =
-        std::ranges::fold_left(sv, std::tuple(0uz, 0uz, 0uz, 0uz, 0uz), [](auto &&accu, auto const &a) {
-            std::get<0>(accu) += (a == '{');
-            std::get<1>(accu) += (a == '}');
-            std::get<2>(accu) += (a == '\n');
-            std::get<3>(accu) += (a == ',');
-            std::get<4>(accu) += (a == '\t');
-            return accu;
-        });
+    auto const count_symbols = detail::simd_scan::count_bytes<'{', '}', '\n', ',', '\t'>(sv);
 
     if (std::get<2>(count_symbols) == 0) { return std::unexpected(incerr_c::make(CSV_containsZeroNewLineChars)); }
 
@@ -190,210 +648,482 @@ std::expected<input_t, incerr_c> Parser::assess_inputType(std::string_view const
 }
 
 std::expected<DataStore::DS_CtorObj, incerr_c> Parser::dispatch_toParsers(input_t const          &inp_t,
-                                                                          std::string_view const &sv) {
+                                                                          std::string_view const &sv,
+                                                                          ParseOptions const     &opts) {
+    // JSON is parsed whole, so it can only be sampled down to the row budget afterwards
+    auto decimate = std::bind_back(decimate_toRowBudget, opts.rowBudget);
     switch (inp_t) {
-        case input_t::NDJSON: return parse_NDJSON(sv);
-        case input_t::JSON:   return parse_JSON(sv);
-        case input_t::CSV:    return parse_CSV(sv);
-        case input_t::TSV:    return parse_TSV(sv);
-        default:              std::unreachable();
+        case input_t::NDJSON:        return parse_NDJSON(sv, opts);
+        case input_t::JSON:          return parse_JSON(sv, opts).transform(decimate);
+        case input_t::JSON_columnar: return parse_JSON_columnar(sv, opts).transform(decimate);
+        case input_t::CSV:           return parse_CSV(sv, opts);
+        case input_t::TSV:           return parse_TSV(sv, opts);
+        default:                     std::unreachable();
     }
     std::unreachable();
 }
 
 // MAIN INTENDED INTERFACE METHOD
 // Dispatches the string_view to the right parser and constructs DataStore
-std::expected<DataStore, incerr_c> Parser::parse(std::string_view const sv) {
+std::expected<DataStore, incerr_c> Parser::parse(std::string_view const sv, ParseOptions const &opts) {
     std::string_view const trimmed = get_trimmedSV(sv);
 
     auto c_dstr = [](auto &&data) { return DataStore(std::forward<decltype(data)>(data)); };
-    return assess_inputType(trimmed).and_then(std::bind_back(dispatch_toParsers, trimmed)).transform(c_dstr);
+    return assess_inputType(trimmed).and_then(std::bind_back(dispatch_toParsers, trimmed, opts)).transform(c_dstr);
 }
 
-// PARSE USING RANAV::CSV2
-std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_usingCSV2(auto                 &&csv2Reader,
-                                                                       std::string_view const trimmed) {
-
-    if (not csv2Reader.parse_view(trimmed)) { return std::unexpected(incerr_c::make(CSV_parserBackendError)); }
+std::expected<DataStore, incerr_c> Parser::parse(std::shared_ptr<InputBuffer const> const &inputBuffer,
+                                                 ParseOptions                              opts) {
+    std::string_view const trimmed = get_trimmedSV(inputBuffer->get_view());
+    opts.zeroCopyStrings           = true;
 
-    // Header 'size' for verification later
-    size_t hdr_sz = 0;
-    for (auto const &hdrItem : csv2Reader.header()) { hdr_sz++; }
+    auto c_dstr = [&](auto &&data) {
+        DataStore res(std::forward<decltype(data)>(data));
+        res.m_inputBuffers.push_back(inputBuffer);
+        return res;
+    };
+    return assess_inputType(trimmed).and_then(std::bind_back(dispatch_toParsers, trimmed, opts)).transform(c_dstr);
+}
 
-    DataStore::DS_CtorObj res;
-    std::vector<CellType> cellTypes;
-    if (csv2Reader.rows() < 1) { return std::unexpected(incerr_c::make(JSON_isEmpty)); }
+// STREAMING INTERFACE
+size_t Parser::get_completeRowsSize(StreamState const &state, std::string_view const pending, size_t const minRows) {
+    // Type of the first part is not known yet, anything but NDJSON might be quoted
+    bool const quoteAware = state.inp_t.has_value() ? state.inp_t.value() != input_t::NDJSON
+                                                    : not pending.starts_with('{');
 
-    // Set US locale for use in parsing CSV
-    std::string orig_loc = std::setlocale(LC_ALL, nullptr);
-    std::setlocale(LC_ALL, "en_US.UTF-8");
+    size_t res = 0, rowCount = 0;
+    if (not quoteAware) {
+        res      = pending.rfind('\n') == std::string_view::npos ? 0uz : pending.rfind('\n') + 1;
+        rowCount = minRows > 1 ? static_cast<size_t>(std::ranges::count(pending.substr(0, res), '\n')) : 1uz;
+    }
+    else {
+        // Quotes escaped by doubling them just toggle the state twice
+        bool inQuotes = false;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            if (pending[i] == '"') { inQuotes = not inQuotes; }
+            else if (pending[i] == '\n' && not inQuotes) {
+                res = i + 1;
+                ++rowCount;
+            }
+        }
+    }
+    return (res != 0 && rowCount >= minRows) ? res : 0uz;
+}
 
-    {
-        using varVec_t    = DataStore::vec_pr_varCol_t::value_type::second_type;
-        auto   headerItem = csv2Reader.header().begin();
-        size_t id         = 0;
-
-        auto const &rowIter = *csv2Reader.begin();
-        // auto const &aaa = (*rowIter);
-
-        for (auto const &firstRow : csv2Reader) {
-            for (auto const &cell : firstRow) {
-                if (not(id < hdr_sz)) { return std::unexpected(incerr_c::make(CSV_headerHasLessItemsThanDataRow)); }
-
-                switch (assess_cellType(cell)) {
-                    case CellType::double_like:
-                        res.data.push_back(
-                            std::make_pair(std::string((*headerItem).read_view()), varVec_t(std::vector<double>())));
-                        cellTypes.push_back(CellType::double_like);
-                        break;
+std::expected<void, incerr_c> Parser::parse_streamPart(StreamState &state, std::string_view const complete) {
+    std::string_view const trimmed = get_trimmedSV(complete);
+    if (trimmed.empty()) { return {}; }
+
+    if (not state.res.has_value()) {
+        // JSON cannot be parsed in parts and neither can an input which isn't recognizable from its first part
+        auto const assessed = assess_inputType(trimmed);
+        if (not assessed.has_value() || assessed.value() == input_t::JSON ||
+            assessed.value() == input_t::JSON_columnar) {
+            state.wholeInputMode = true;
+            return {};
+        }
 
-                    case CellType::ll_like:
-                        res.data.push_back(
-                            std::make_pair(std::string((*headerItem).read_view()), varVec_t(std::vector<long long>())));
-                        cellTypes.push_back(CellType::ll_like);
-                        break;
+        auto ctorObj = dispatch_toParsers(assessed.value(), trimmed);
+        if (not ctorObj.has_value()) { return std::unexpected(ctorObj.error()); }
 
-                    case CellType::string_like:
-                        res.data.push_back(std::make_pair(std::string((*headerItem).read_view()),
-                                                          varVec_t(std::vector<std::string>())));
-                        cellTypes.push_back(CellType::string_like);
-                        break;
-                    default: return std::unexpected(incerr_c::make(CSV_unhandledCellType));
-                }
-                res.itemFlags.push_back({});
-                ++id;
-                ++headerItem;
-            }
-            if (id != hdr_sz) { return std::unexpected(incerr_c::make(CSV_headerHasMoreItemsThanDataRow)); }
-            break;
+        state.inp_t = assessed.value();
+        switch (state.inp_t.value()) {
+            case input_t::CSV: state.colNames = tokenize_header<','>(trimmed.substr(0, trimmed.find('\n'))); break;
+            case input_t::TSV: state.colNames = tokenize_header<'\t'>(trimmed.substr(0, trimmed.find('\n'))); break;
+            // All the keys are projected (there are no options here), so the columns are the keys of the first record
+            default:
+                for (auto const &[colName, _] : ctorObj->data) { state.colNames.push_back(colName); }
         }
+        state.res.emplace(std::move(ctorObj.value()));
+        return {};
     }
 
-    for (auto const &row : csv2Reader) {
-        size_t i = 0;
-        for (auto const &cell : row) {
-            if (not(i < hdr_sz)) { return std::unexpected(incerr_c::make(CSV_headerHasLessItemsThanDataRow)); }
-            // Error when not the same type
-            // However if trying to parse 'something which looks like long long' into double ... then that's fine
+    // Columns start with the types they have so far, the same as if the whole input was parsed at once
+    auto get_colType = [&](size_t const colID) { return state.res->m_data.at(colID).get_colType(); };
+
+    std::expected<DataStore::DS_CtorObj, incerr_c> ctorObj;
+    if (state.inp_t.value() == input_t::NDJSON) {
+        DataStore::DS_CtorObj schema;
+        for (size_t colID = 0; colID < state.colNames.size(); ++colID) {
+            schema.data.push_back(std::make_pair(
+                state.colNames[colID], get_colType(colID) == parsedVal_t::string_like
+                                           ? DataStore::varCol_t(std::vector<std::string>())
+                                       : get_colType(colID) == parsedVal_t::double_like
+                                           ? DataStore::varCol_t(std::vector<double>())
+                                           : DataStore::varCol_t(std::vector<long long>())));
+            schema.itemFlags.push_back({});
+        }
+        ctorObj = parse_NDJSONRecords(trimmed, schema, state.colNames, {}, 0uz);
+    }
+    else {
+        auto parse_rows = [&]<char delim>() {
+            DelimitedSchema schema = infer_delimitedSchema<delim>(state.colNames, std::string_view{}, {});
+            for (size_t colID = 0; colID < schema.cellTypes.size(); ++colID) {
+                schema.cellTypes[colID] = get_colType(colID) == parsedVal_t::string_like   ? CellType::string_like
+                                          : get_colType(colID) == parsedVal_t::double_like ? CellType::double_like
+                                                                                           : CellType::ll_like;
+            }
+            return parse_delimitedInParallel<delim>(trimmed, schema, {});
+        };
+        ctorObj = state.inp_t.value() == input_t::CSV ? parse_rows.template operator()<','>()
+                                                      : parse_rows.template operator()<'\t'>();
+    }
+    if (not ctorObj.has_value()) { return std::unexpected(ctorObj.error()); }
 
-            auto assessed_ct = assess_cellType(cell);
-            if (assessed_ct != cellTypes[i] && assessed_ct != CellType::null_like &&
-                (not((assessed_ct == CellType::ll_like) && cellTypes[i] == CellType::double_like))) {
+    auto valid = validate_appendable(state.res.value(), ctorObj.value(), state.inp_t.value());
+    if (not valid.has_value()) { return valid; }
+    state.res->append_data(ctorObj.value());
+    return {};
+}
 
-                auto testSV = cell.read_view();
-                // TODO: Finally fix the problem of 'mixed types' by pre-evaluating the whole data file
-                return std::unexpected(incerr_c::make(CSV_valueTypeDoesntMatch));
-            }
+std::expected<DataStore, incerr_c> Parser::parse_stream(chunkReader_t const &reader) {
+    // gzip/zstd compressed input is decompressed on the fly, anything else passes through unchanged
+    detail::decompress::TransparentReader input(reader);
+    StreamState                           state;
+
+    // Holds the not yet parsed (incomplete) rest of the input
+    std::string pending;
+
+    bool endOfInput = false;
+    while (not endOfInput) {
+        size_t const origSize = pending.size();
+        pending.resize(origSize + Config::parser_streamChunkSize);
+        size_t const readCount =
+            input.read(std::span<char>(pending.data() + origSize, Config::parser_streamChunkSize));
+        pending.resize(origSize + readCount);
+        endOfInput = (readCount == 0);
+
+        // Rest of a corrupted or truncated compressed input must not get parsed as if it was complete
+        if (endOfInput && input.get_error().has_value()) { return std::unexpected(input.get_error().value()); }
+        if (state.wholeInputMode) { continue; }
+
+        // Only complete rows get parsed, the incomplete rest is carried over into the next round
+        // The first part needs at least the first two rows (the header and the first data row for CSV/TSV)
+        size_t const cutAt =
+            endOfInput ? pending.size() : get_completeRowsSize(state, pending, state.res.has_value() ? 1uz : 2uz);
+        if (cutAt == 0) { continue; }
+
+        auto chunkRes = parse_streamPart(state, std::string_view(pending).substr(0, cutAt));
+        if (not chunkRes.has_value()) { return std::unexpected(chunkRes.error()); }
+        if (not state.wholeInputMode) { pending.erase(0, cutAt); }
+    }
 
-            auto vis = [&](auto &variVec) -> void {
-                // Selecting the right conversion based on the type inside the variant
-                if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<double>>) {
-                    if (assessed_ct == CellType::null_like) { variVec.push_back(0.0); }
-                    else { variVec.push_back(conv_cellToDouble(cell)); }
-                }
-                else if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<long long>>) {
-                    if (assessed_ct == CellType::null_like) { variVec.push_back(0ll); }
-                    else { variVec.push_back(conv_cellToLongLong(cell)); }
-                }
-                else if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<std::string>>) {
-                    if (assessed_ct == CellType::null_like) {}
-                    variVec.push_back(conv_cellToString(cell));
-                }
-                // This should be impossible to instantiate
-                else { static_assert(false); };
+    if (state.wholeInputMode) { return parse(pending); }
+    else if (not state.res.has_value()) { return std::unexpected(incerr_c::make(JSON_isEmpty)); }
+    return std::move(state.res.value());
+}
 
-                res.itemFlags[i].push_back(assessed_ct == CellType::null_like ? 0b1 : 0b0);
-            };
+std::expected<DataStore, incerr_c> Parser::parse_stream(std::istream &inputStream) {
+    return parse_stream([&](std::span<char> buf) -> size_t {
+        inputStream.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+        return static_cast<size_t>(inputStream.gcount());
+    });
+}
 
-            std::visit(vis, res.data.at(i).second);
-            ++i;
+std::expected<DataStore, incerr_c> Parser::parse_stream(int const fileDescriptor) {
+    return parse_stream([&](std::span<char> buf) -> size_t {
+        while (true) {
+#if defined(_WIN32)
+            auto const readCount = ::_read(fileDescriptor, buf.data(), static_cast<unsigned int>(buf.size()));
+#else
+            auto const readCount = ::read(fileDescriptor, buf.data(), buf.size());
+            if (readCount < 0 && errno == EINTR) { continue; }
+#endif
+            // Read errors are treated as the end of input
+            return readCount > 0 ? static_cast<size_t>(readCount) : 0uz;
         }
-        if (i != hdr_sz) { return std::unexpected(incerr_c::make(CSV_headerHasMoreItemsThanDataRow)); }
+    });
+}
+
+// PARSE DELIMITED (CSV AND TSV)
+// Header is parsed and types of the columns are inferred on the calling thread
+// Data rows are then split into chunks parsed in parallel, fragments parsed from the chunks are concatenated in order
+template <char delim>
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_delimited(std::string_view const trimmed,
+                                                                       ParseOptions const    &opts) {
+    size_t const hdrEnd = trimmed.find('\n');
+    if (hdrEnd == std::string_view::npos || get_trimmedSV(trimmed.substr(hdrEnd + 1)).empty()) {
+        return std::unexpected(incerr_c::make(JSON_isEmpty));
     }
 
-    // Restore original locale so that we 'clean up' after ourselves
-    std::setlocale(LC_ALL, orig_loc.c_str());
+    std::string_view const rows = trimmed.substr(hdrEnd + 1);
+    return parse_delimitedInParallel<delim>(
+        rows, infer_delimitedSchema<delim>(tokenize_header<delim>(trimmed.substr(0, hdrEnd)), rows, opts), opts);
+}
+
+template <char delim>
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_delimitedInParallel(std::string_view const rows,
+                                                                                 DelimitedSchema const &schema,
+                                                                                 ParseOptions const    &opts) {
+    auto const chunks = split_atRowBoundaries(rows, get_parallelChunkCount(rows.size()), true);
+
+    std::vector<RowStride> const rowStrides = opts.rowBudget.has_value()
+                                                  ? compute_rowStrides(chunks, opts.rowBudget.value(), 0uz)
+                                                  : std::vector<RowStride>(chunks.size());
+
+    // Number parsing doesn't depend on the locale, so no need to set (the process-wide) one here
+    auto res = parse_chunksInParallel(chunks, [&](std::string_view const chunk, size_t const chunkID) {
+        return parse_delimitedRows<delim>(chunk, schema, opts, rowStrides[chunkID]);
+    });
+    // Types of the columns are final now
+    if (res.has_value()) { res->sourceFields.clear(); }
     return res;
 }
 
-// JSON AND NDJSON
-std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_NDJSON(std::string_view const &trimmed) {
+// Rows are counted just by a (vectorized) scan for newlines, so that it is much cheaper than parsing
+// Newlines inside of quotes get counted too, the sample then ends up somewhat smaller than the budget
+std::vector<Parser::RowStride> Parser::compute_rowStrides(std::vector<std::string_view> const &chunks,
+                                                          size_t const rowBudget, size_t const rowsBefore) {
+    std::vector<size_t> chunkRowCounts;
+    for (auto const &chunk : chunks) {
+        chunkRowCounts.push_back(chunk.empty() ? 0uz : detail::simd_scan::count_bytes<'\n'>(chunk)[0] + 1);
+    }
 
-    std::vector<NLMjson> parsed;
-    for (auto const &oneLine : std::views::split(trimmed, '\n') |
-                                   std::views::transform([](auto const &in) { return std::string_view(in); })) {
-        NLMjson oneLineJson;
-        try {
-            oneLineJson = NLMjson::parse(oneLine);
-        }
-        catch (const NLMjson::exception &e) {
-            // TODO: Finally figure out how to handle exceptions somewhat professionally
-            return std::unexpected(incerr_c::make(JSON_parserBackendError));
-        }
-        // TODO: Consider if and how we need to flatten each line of NDJSON
-        // oneLineJson = oneLineJson.flatten();
-        parsed.push_back(std::move(oneLineJson));
+    size_t const totalRowCount = rowsBefore + std::ranges::fold_left(chunkRowCounts, 0uz, std::plus());
+    size_t const stride        = get_rowStride(totalRowCount, rowBudget);
+
+    std::vector<RowStride> res;
+    for (size_t firstRowID = rowsBefore; auto const &chunkRowCount : chunkRowCounts) {
+        res.push_back(RowStride{.stride = stride, .firstRowID = firstRowID});
+        firstRowID += chunkRowCount;
     }
+    return res;
+}
 
-    if (parsed.size() == 0) { return std::unexpected(incerr_c::make(NDJSON_isEmpty)); }
+// Splits 'rows' into (at most) 'maxChunks' chunks of similar size
+// Splits only at newlines (outside of quotes if 'quoteAware') so that each chunk holds whole rows
+std::vector<std::string_view> Parser::split_atRowBoundaries(std::string_view const rows, size_t const maxChunks,
+                                                            bool const quoteAware) {
+    std::vector<std::string_view> res;
+    size_t const                  targetSize = std::max(rows.size() / std::max(maxChunks, 1uz), 1uz);
+    bool const                    hasQuotes  = quoteAware && rows.find('"') != std::string_view::npos;
+
+    size_t chunkBeg = 0, scanned = 0;
+    bool   inQuotes = false;
+    while (res.size() + 1 < maxChunks && chunkBeg + targetSize < rows.size()) {
+        size_t cutAt = chunkBeg + targetSize;
+        if (not hasQuotes) { cutAt = rows.find('\n', cutAt); }
+        else {
+            // Quote state at 'cutAt' depends on everything before it
+            inQuotes ^= (std::ranges::count(rows.substr(scanned, cutAt - scanned), '"') & 1);
+            for (; cutAt < rows.size(); ++cutAt) {
+                if (rows[cutAt] == '"') { inQuotes = not inQuotes; }
+                else if (rows[cutAt] == '\n' && not inQuotes) { break; }
+            }
+            scanned = std::min(cutAt + 1, rows.size());
+        }
+        if (cutAt >= rows.size()) { break; }
 
+        res.push_back(rows.substr(chunkBeg, cutAt - chunkBeg));
+        chunkBeg = cutAt + 1;
+    }
+    if (chunkBeg < rows.size()) { res.push_back(rows.substr(chunkBeg)); }
+    return res;
+}
 
-    // Construct 'vec_pr_strVarVec_t' based on the first line
-    DataStore::DS_CtorObj         res;
-    std::vector<NLMjson::value_t> temp_firstLineTypes;
+// Parses header-less data rows of one chunk, columns start with the types of the schema (see 'DelimitedSchema')
+// Any 'wider' value encountered later promotes the column in place (long long -> double -> string)
+// Columns without any value so far are kept as long long
+// Fields go straight from the tokenizer into the typed columns
+template <char delim>
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_delimitedRows(std::string_view const rows,
+                                                                           DelimitedSchema const &schema,
+                                                                           ParseOptions const    &opts,
+                                                                           RowStride const       &rowStride) {
+    size_t const hdr_sz         = schema.colNames.size();
+    auto const  &projectedIDs   = schema.projectedIDs;
+    auto const  &projectedNames = schema.projectedNames;
+    auto const  &hintedTypes    = schema.hintedTypes;
+
+    std::vector<CellType> cellTypes = schema.cellTypes;
 
-    for (auto const &[key, val] : parsed.front().items()) {
-        if (val.type() == NLMjson::value_t::string) {
-            res.data.push_back(
-                std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<std::string>())));
-        }
-        else if (val.type() == NLMjson::value_t::number_float) {
-            res.data.push_back(
-                std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<double>())));
+    DataStore::DS_CtorObj res;
+    {
+        using varVec_t = DataStore::vec_pr_varCol_t::value_type::second_type;
+        for (auto const &[ct, colName] : std::views::zip(cellTypes, projectedNames)) {
+            switch (ct) {
+                case CellType::double_like:
+                    res.data.push_back(std::make_pair(colName, varVec_t(std::vector<double>())));
+                    break;
+                case CellType::string_like:
+                    res.data.push_back(std::make_pair(colName, opts.zeroCopyStrings
+                                                                   ? varVec_t(std::vector<std::string_view>())
+                                                                   : varVec_t(std::vector<std::string>())));
+                    break;
+                default: res.data.push_back(std::make_pair(colName, varVec_t(std::vector<long long>())));
+            }
+            res.itemFlags.push_back({});
         }
-        else if (val.type() == NLMjson::value_t::number_integer || val.type() == NLMjson::value_t::number_unsigned) {
-            res.data.push_back(
-                std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<long long>())));
+    }
+    if (not opts.lazyColumns) {
+        res.sourceFields.assign(projectedNames.size(),
+                                DataStore::FieldIndex{.input = rows, .zeroCopyStrings = opts.zeroCopyStrings});
+    }
+    else {
+        res.fieldIndices.assign(projectedNames.size(),
+                                DataStore::FieldIndex{.input = rows, .zeroCopyStrings = opts.zeroCopyStrings});
+        for (auto const &[fieldIndex, hinted] : std::views::zip(res.fieldIndices, hintedTypes)) {
+            if (not hinted.has_value()) { continue; }
+            fieldIndex.typeHint = hinted == CellType::double_like ? parsedVal_t::double_like
+                                  : hinted == CellType::ll_like   ? parsedVal_t::signed_like
+                                                                  : parsedVal_t::string_like;
         }
-        else {}
-        temp_firstLineTypes.push_back(val.type());
-        res.itemFlags.push_back({});
     }
 
-    for (auto const &parsedLine : parsed) {
-        if (parsedLine.size() != res.data.size()) { return std::unexpected(incerr_c::make(JSON_objectsNotOfSameSize)); }
-        for (int i = 0; auto const &[key, val] : parsedLine.items()) {
-            if (key != res.data[i].first) { return std::unexpected(incerr_c::make((JSON_keyNameDoesntMatch))); }
-            // TODO: Problem with type checking different NDJSON lines
+    // Rows not sampled are still tokenized (and checked for the number of fields), but never converted
+    size_t                  rowID     = 0;
+    bool                    rowIsKept = rowStride.is_kept(rowID);
+    std::optional<incerr_c> rowError  = std::nullopt;
+
+    auto on_field = [&](size_t const colID, std::string_view const field) -> void {
+        // Surplus fields are reported as error at the end of the row
+        if (not(colID < hdr_sz) || not rowIsKept) { return; }
+        size_t const i = projectedIDs[colID];
+        if (i == std::string_view::npos) { return; }
+        if (opts.lazyColumns) {
+            res.fieldIndices[i].push_back(field);
+            return;
+        }
 
-            bool isNullLike = val.is_null() || (val.is_string() && (val.template get<std::string>() == ""));
-            if (isNullLike) { res.itemFlags[i].push_back(0b1); }
-            else if (val.type() != temp_firstLineTypes[i] &&
-                     (val.type() == NLMjson::value_t::string || temp_firstLineTypes[i] == NLMjson::value_t::string)) {
-                return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+        TypedCell typedCell;
+        // Hinted columns are never promoted, cell which doesn't convert into the hinted type is an error
+        if (hintedTypes[i].has_value()) {
+            auto const converted = convert_hintedCell(field, hintedTypes[i].value());
+            if (not converted.has_value()) {
+                if (not rowError.has_value()) { rowError = incerr_c::make(CSV_valueTypeDoesntMatch); }
+                return;
             }
-            else { res.itemFlags[i].push_back(0b0); }
-
-            switch (res.data[i].second.index()) {
-                case 0uz:
-                    std::get<0>(res.data[i].second).push_back(isNullLike ? "" : val.template get<std::string>());
-                    break;
-                case 1uz:
-                    std::get<1>(res.data[i].second).push_back(isNullLike ? 0ll : val.template get<long long>());
-                    break;
-                case 2uz:
-                    std::get<2>(res.data[i].second).push_back(isNullLike ? 0.0 : val.template get<double>());
-                    break;
+            typedCell = converted.value();
+        }
+        else { typedCell = assess_typedCell(field); }
+        CellType const assessed_ct = typedCell.type;
+
+        // Promote the column if the value doesn't fit into it, values converted so far are carried over
+        // Column promoted into strings takes the text of its cells so far from 'sourceFields' instead
+        if (CellType const widened = widen_cellType(cellTypes[i], assessed_ct); widened != cellTypes[i]) {
+            if (widened == CellType::double_like) {
+                DataStore::promote_varCol(res.data[i].second, res.itemFlags[i], parsedVal_t::double_like);
+            }
+            else if (widened == CellType::string_like) {
+                DataStore::promote_varCol(res.data[i].second, res.itemFlags[i], parsedVal_t::string_like,
+                                          res.sourceFields[i]);
+                res.sourceFields[i] = DataStore::FieldIndex{};
+            }
+            cellTypes[i] = widened;
+        }
+        if (cellTypes[i] != CellType::string_like && not hintedTypes[i].has_value()) {
+            res.sourceFields[i].push_back(field);
+        }
 
-                default: std::unreachable();
+        auto vis = [&](auto &variVec) -> void {
+            // Selecting the right value based on the type inside the variant
+            if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<double>>) {
+                if (assessed_ct == CellType::null_like) { variVec.push_back(0.0); }
+                else if (assessed_ct == CellType::ll_like) { variVec.push_back(static_cast<double>(typedCell.llVal)); }
+                else { variVec.push_back(typedCell.dblVal); }
+            }
+            else if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<long long>>) {
+                if (assessed_ct == CellType::null_like) { variVec.push_back(0ll); }
+                else { variVec.push_back(typedCell.llVal); }
+            }
+            else if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<std::string>>) {
+                variVec.push_back(std::string(field));
+            }
+            // Views into the input, the caller guarantees it outlives them
+            else if constexpr (std::same_as<std::decay_t<decltype(variVec)>, std::vector<std::string_view>>) {
+                variVec.push_back(field);
             }
+            // This should be impossible to instantiate
+            else { static_assert(false); };
+
+            res.itemFlags[i].push_back(assessed_ct == CellType::null_like ? 0b1 : 0b0);
+        };
+        std::visit(vis, res.data[i].second);
+    };
+
+    auto on_rowEnd = [&](size_t const fieldCount) -> bool {
+        if (rowError.has_value()) { return false; }
+        if (fieldCount > hdr_sz) { rowError = incerr_c::make(CSV_headerHasLessItemsThanDataRow); }
+        else if (fieldCount < hdr_sz) { rowError = incerr_c::make(CSV_headerHasMoreItemsThanDataRow); }
+        rowIsKept = rowStride.is_kept(++rowID);
+        return not rowError.has_value();
+    };
+
+    detail::csv_tokenizer::tokenize<delim>(rows, on_field, on_rowEnd);
+    if (rowError.has_value()) { return std::unexpected(rowError.value()); }
+    if (rowStride.stride > 1) { res.sourceRowCount = rowID; }
+    return res;
+}
 
-            ++i;
+// JSON AND NDJSON
+// Lines are parsed one by one with SAX, values go straight into columns (no JSON objects are ever constructed)
+// Lines not sampled (see 'Parser::RowStride') are skipped entirely (JSON needs no tokenizing to find where a line ends)
+static std::expected<DataStore::DS_CtorObj, incerr_c> parse_NDJSONLines(std::string_view const          lines,
+                                                                        DataStore::DS_CtorObj         &&into,
+                                                                        NDJSON_SAXHandler::RecordKeys &recordKeys,
+                                                                        ParseOptions const            &opts,
+                                                                        bool const  definesSchema,
+                                                                        auto const &rowStride) {
+    NDJSON_SAXHandler handler(into, recordKeys, opts, definesSchema);
+    size_t            lineID = 0;
+    for (auto const &oneLine : std::views::split(lines, '\n') |
+                                   std::views::transform([](auto const &in) { return std::string_view(in); })) {
+        if (not rowStride.is_kept(lineID++)) { continue; }
+        if (not NLMjson::sax_parse(oneLine, &handler)) {
+            return std::unexpected(handler.get_error().value_or(incerr_c::make(JSON_parserBackendError)));
         }
     }
+    if (rowStride.stride > 1) { into.sourceRowCount = lineID; }
+    return std::move(into);
+}
+
+// First line defines the schema, the rest is split at newlines into chunks parsed in parallel against that schema
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_NDJSON(std::string_view const &trimmed,
+                                                                    ParseOptions const     &opts) {
+    if (trimmed.empty()) { return std::unexpected(incerr_c::make(NDJSON_isEmpty)); }
+    size_t const firstLineEnd = trimmed.find('\n');
+
+    // The first line is always kept (its row ID is 0)
+    NDJSON_SAXHandler::RecordKeys recordKeys;
+    auto res = parse_NDJSONLines(trimmed.substr(0, firstLineEnd), DataStore::DS_CtorObj{}, recordKeys, opts, true,
+                                 RowStride{});
+    if (not res.has_value() || firstLineEnd == std::string_view::npos) { return res; }
+
+    // Empty columns of the same names and types as in the first record
+    DataStore::DS_CtorObj schema;
+    for (auto const &[colName, colVar] : res.value().data) {
+        schema.data.push_back(std::make_pair(
+            colName, std::visit([](auto const &vec) { return DataStore::varCol_t(std::decay_t<decltype(vec)>()); },
+                                colVar)));
+        schema.itemFlags.push_back({});
+    }
+
+    auto restParsed = parse_NDJSONRecords(trimmed.substr(firstLineEnd + 1), schema, recordKeys.names, opts, 1uz);
+    if (not restParsed.has_value()) { return std::unexpected(restParsed.error()); }
+
+    append_fragment(res.value(), std::move(restParsed.value()));
     return res;
 }
-std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_view const &trimmed) {
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_NDJSONRecords(std::string_view const          lines,
+                                                                           DataStore::DS_CtorObj const    &schema,
+                                                                           std::vector<std::string> const &keys,
+                                                                           ParseOptions const             &opts,
+                                                                           size_t const rowsBefore) {
+    NDJSON_SAXHandler::RecordKeys recordKeys{.names = keys, .isProjected = {}};
+    for (auto const &key : keys) { recordKeys.isProjected.push_back(opts.is_projected(key)); }
+
+    auto const                   chunks     = split_atRowBoundaries(lines, get_parallelChunkCount(lines.size()), false);
+    std::vector<RowStride> const rowStrides = opts.rowBudget.has_value()
+                                                  ? compute_rowStrides(chunks, opts.rowBudget.value(), rowsBefore)
+                                                  : std::vector<RowStride>(chunks.size());
+    if (chunks.empty()) { return DataStore::DS_CtorObj(schema); }
+
+    return parse_chunksInParallel(chunks, [&](std::string_view const chunk, size_t const chunkID) {
+        return parse_NDJSONLines(chunk, DataStore::DS_CtorObj(schema), recordKeys, opts, false, rowStrides[chunkID]);
+    });
+}
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_view const &trimmed,
+                                                                  ParseOptions const     &opts) {
 
     NLMjson wholeJson;
     try {
@@ -411,53 +1141,124 @@ std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_vi
 
     // The 'second level' is structured
     if (wholeJson.items().begin().value().is_structured()) {
-        if (std::ranges::any_of(wholeJson.items().begin().value().items(),
-                                [](auto const &a) { return a.value().is_structured(); })) {
-            // Flatten any 'structuring on the 'third level' down
-            for (auto &oneRecord : wholeJson) {
-                for (auto &oneItemInRecord : oneRecord) {
-                    if (oneItemInRecord.is_structured()) { oneItemInRecord = oneItemInRecord.flatten(); }
+        NLMjson const &firstRecord = wholeJson.items().begin().value();
+
+        // Each column is one 'leaf' value of the first record
+        // Nested ('third level' and deeper) values are addressed by paths precomputed from the first record
+        // Column names of nested values are the same as keys of 'flattened' objects (just without the leading '/')
+        // Leaves not projected get no path, so they are never converted (records are still checked for their keys)
+        struct PathStep {
+            std::string key;
+            size_t      arrayID;
+        };
+        std::vector<std::vector<PathStep>> colPaths;
+        std::vector<std::string>           colNames;
+
+        auto add_leaves = [&](this auto const &self, NLMjson const &val, std::vector<PathStep> &path,
+                              std::string const &name) -> void {
+            if (val.is_structured() && not val.empty()) {
+                for (size_t arrayID = 0; auto const &[key, subVal] : val.items()) {
+                    path.push_back(PathStep{key, arrayID++});
+                    self(subVal, path, name + '/' + key);
+                    path.pop_back();
                 }
             }
+            else if (opts.is_projected(name)) {
+                colPaths.push_back(path);
+                colNames.push_back(name);
+            }
+        };
+        for (size_t arrayID = 0; auto const &[key, val] : firstRecord.items()) {
+            std::vector<PathStep> path{PathStep{key, arrayID++}};
+            add_leaves(val, path, key);
         }
 
+        // Walks the precomputed path, returns nullptr if there is no such value in this record
+        // Keys of each record are checked to be in the order of the first record (before any of its values is looked
+        // for), so the first step is taken by position, only the nested steps look their keys up
+        auto get_atPath = [](NLMjson const &record, std::vector<PathStep> const &path) -> NLMjson const * {
+            if (path.empty() || not record.is_structured() || path.front().arrayID >= record.size()) { return nullptr; }
+            size_t const   firstID = path.front().arrayID;
+            NLMjson const *cur     = record.is_object()
+                                         ? &(record.get_ref<NLMjson::object_t const &>().begin() + firstID)->second
+                                         : &record[firstID];
+            for (auto const &step : std::views::drop(path, 1)) {
+                if (cur->is_object()) {
+                    auto const found = cur->find(step.key);
+                    if (found == cur->end()) { return nullptr; }
+                    cur = &(*found);
+                }
+                else if (cur->is_array() && step.arrayID < cur->size()) { cur = &(*cur)[step.arrayID]; }
+                else { return nullptr; }
+            }
+            return cur;
+        };
+
         DataStore::DS_CtorObj         res;
         std::vector<NLMjson::value_t> temp_firstLineTypes;
+        std::vector<bool>             isHintedLL; // Such columns take only numbers that are exactly integers
 
         // First 'record' determines the structure of each record.
-        for (auto const &[key, val] : wholeJson.items().begin().value().items()) {
+        for (auto const &[colPath, colName] : std::views::zip(colPaths, colNames)) {
+            NLMjson const &val = *get_atPath(firstRecord, colPath);
+            isHintedLL.push_back(opts.get_schemaHint(colName) == ColumnHint::ll_like);
+            // Hinted columns need not be decided by the first record, numeric values are converted as needed
+            if (auto hinted = make_hintedColumn(opts, colName); hinted.has_value()) {
+                bool const isStrCol = std::holds_alternative<std::vector<std::string>>(hinted.value());
+                res.data.push_back(std::make_pair(colName, std::move(hinted.value())));
+                temp_firstLineTypes.push_back(isStrCol ? NLMjson::value_t::string : NLMjson::value_t::number_float);
+                res.itemFlags.push_back({});
+                continue;
+            }
             if (val.type() == NLMjson::value_t::string) {
                 res.data.push_back(std::make_pair(
-                    key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<std::string>())));
+                    colName, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<std::string>())));
             }
             else if (val.type() == NLMjson::value_t::number_float) {
-                res.data.push_back(
-                    std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<double>())));
+                res.data.push_back(std::make_pair(
+                    colName, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<double>())));
             }
             else if (val.type() == NLMjson::value_t::number_integer ||
                      val.type() == NLMjson::value_t::number_unsigned) {
-                res.data.push_back(
-                    std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<long long>())));
+                res.data.push_back(std::make_pair(
+                    colName, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<long long>())));
             }
-            else {}
+            else { return std::unexpected(incerr_c::make(JSON_unhandledCellType)); }
             temp_firstLineTypes.push_back(val.type());
             res.itemFlags.push_back({});
         }
 
         for (auto const &[key_l1, val_l1] : wholeJson.items()) {
-            if (val_l1.size() != res.data.size()) { return std::unexpected(incerr_c::make(JSON_objectsNotOfSameSize)); }
+            // CHECKS
+            if (val_l1.size() != firstRecord.size()) {
+                return std::unexpected(incerr_c::make(JSON_objectsNotOfSameSize));
+            }
+            if (val_l1.is_object()) {
+                auto firstRecord_IT = firstRecord.items().begin();
+                for (auto const &item : val_l1.items()) {
+                    if (item.key() != firstRecord_IT.key()) {
+                        return std::unexpected(incerr_c::make(JSON_keyNameDoesntMatch));
+                    }
+                    ++firstRecord_IT;
+                }
+            }
 
-            for (int i = 0; auto const &[key, val] : val_l1.items()) {
-                // CHECKS
-                if (key != res.data[i].first) { return std::unexpected(incerr_c::make(JSON_keyNameDoesntMatch)); }
+            for (size_t i = 0; i < colPaths.size(); ++i) {
+                NLMjson const *valPtr = get_atPath(val_l1, colPaths[i]);
+                if (valPtr == nullptr) { return std::unexpected(incerr_c::make(JSON_keyNameDoesntMatch)); }
+                NLMjson const &val = *valPtr;
+                if (val.is_structured()) { return std::unexpected(incerr_c::make(JSON_objectsNotOfSameSize)); }
 
-                // Check keys are the same and valTypes are the same on (flattened) 3rd level
-                bool isNullLike = val.is_null() || (val.is_string() && (val.template get<std::string>() == ""));
+                // Check valTypes are the same
+                bool isNullLike = val.is_null() || (val.is_string() && val.get_ref<std::string const &>().empty());
                 if (isNullLike) { res.itemFlags[i].push_back(0b1); }
                 else if (val.type() != temp_firstLineTypes[i] && (val.type() == NLMjson::value_t::string ||
                                                                   temp_firstLineTypes[i] == NLMjson::value_t::string)) {
                     return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
                 }
+                else if (isHintedLL[i] && not is_exactLongLong(val)) {
+                    return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+                }
                 else { res.itemFlags[i].push_back(0b0); }
 
                 // 'CORRECT' PATH
@@ -466,47 +1267,61 @@ std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_vi
                         std::get<0>(res.data[i].second).push_back(isNullLike ? "" : val.template get<std::string>());
                         break;
                     case 1uz:
-                        std::get<1>(res.data[i].second).push_back(isNullLike ? 0.0 : val.template get<double>());
+                        std::get<1>(res.data[i].second).push_back(isNullLike ? 0ll : val.template get<long long>());
                         break;
                     case 2uz:
-                        std::get<2>(res.data[i].second).push_back(isNullLike ? 0ll : val.template get<long long>());
+                        std::get<2>(res.data[i].second).push_back(isNullLike ? 0.0 : val.template get<double>());
                         break;
                     default: assert(false); std::unreachable();
                 }
-                ++i;
             }
         }
         return res;
     }
     // The 'second level' isn't structured ... that is it is actually just one column of values
+    // Column is named by the first key, it is subject to projection and hints the same as columns of records are
     else {
+        std::string const     colName = wholeJson.items().begin().key();
+        DataStore::DS_CtorObj res2;
+        if (not opts.is_projected(colName)) { return res2; }
+        auto       hinted     = make_hintedColumn(opts, colName);
+        bool const isHintedLL = opts.get_schemaHint(colName) == ColumnHint::ll_like;
+
+        // Hinted column takes any numbers (converted as needed), it only can't mix them with strings (checked below)
         for (auto &oneItem : std::views::drop(wholeJson, 1)) {
+            if (hinted.has_value()) { break; }
             // If any JSON type on 'second level' doesn't match the type of the first record
             if (oneItem.type() != wholeJson.items().begin().value().type() &&
                 not(oneItem.is_null() || (oneItem.is_string() && (oneItem.template get<std::string>() == "")))) {
                 return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
             }
         }
-        DataStore::DS_CtorObj         res2;
         std::vector<NLMjson::value_t> temp_firstLineTypes;
 
         // First 'record' determines the structure of each record.
         for (auto const &[key, val] : std::views::take(wholeJson.items(), 1)) {
-            if (val.type() == NLMjson::value_t::string) {
+            if (hinted.has_value()) {
+                bool const isStrCol = std::holds_alternative<std::vector<std::string>>(hinted.value());
+                res2.data.push_back(std::make_pair(key, std::move(hinted.value())));
+                temp_firstLineTypes.push_back(isStrCol ? NLMjson::value_t::string : NLMjson::value_t::number_float);
+            }
+            else if (val.type() == NLMjson::value_t::string) {
                 res2.data.push_back(std::make_pair(
                     key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<std::string>())));
+                temp_firstLineTypes.push_back(val.type());
             }
             else if (val.type() == NLMjson::value_t::number_float) {
                 res2.data.push_back(
                     std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<double>())));
+                temp_firstLineTypes.push_back(val.type());
             }
             else if (val.type() == NLMjson::value_t::number_integer ||
                      val.type() == NLMjson::value_t::number_unsigned) {
                 res2.data.push_back(
                     std::make_pair(key, DataStore::vec_pr_varCol_t::value_type::second_type(std::vector<long long>())));
+                temp_firstLineTypes.push_back(val.type());
             }
             else { return std::unexpected(incerr_c::make(JSON_unhandledCellType)); }
-            temp_firstLineTypes.push_back(val.type());
             res2.itemFlags.push_back({});
         }
 
@@ -521,6 +1336,9 @@ std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_vi
                      (val.type() == NLMjson::value_t::string || temp_firstLineTypes[0] == NLMjson::value_t::string)) {
                 return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
             }
+            else if (isHintedLL && not is_exactLongLong(val)) {
+                return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+            }
             else { res2.itemFlags[0].push_back(0b0); }
 
             // 'CORRECT' PATH
@@ -529,10 +1347,10 @@ std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_vi
                     std::get<0>(res2.data[0].second).push_back(isNullLike ? "" : val.template get<std::string>());
                     break;
                 case 1uz:
-                    std::get<1>(res2.data[0].second).push_back(isNullLike ? 0.0 : val.template get<double>());
+                    std::get<1>(res2.data[0].second).push_back(isNullLike ? 0ll : val.template get<long long>());
                     break;
                 case 2uz:
-                    std::get<2>(res2.data[0].second).push_back(isNullLike ? 0ll : val.template get<long long>());
+                    std::get<2>(res2.data[0].second).push_back(isNullLike ? 0.0 : val.template get<double>());
                     break;
                 default: assert(false); std::unreachable();
             }
@@ -542,17 +1360,224 @@ std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON(std::string_vi
     std::unreachable();
 }
 
+// Arrays are moved into the columns as a whole, there are no 'records' to check
+// Column type is decided by the first non-null value (and by whether there is any float value in a numeric column)
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_JSON_columnar(std::string_view const &trimmed,
+                                                                           ParseOptions const     &opts) {
+    NLMjson wholeJson;
+    try {
+        wholeJson = NLMjson::parse(trimmed);
+    }
+    catch (const NLMjson::exception &e) {
+        // TODO: Finally figure out how to handle exceptions somewhat professionally
+        return std::unexpected(incerr_c::make(JSON_parserBackendError));
+    }
+    if (not wholeJson.is_object() || wholeJson.empty()) { return std::unexpected(incerr_c::make(JSON_isEmpty)); }
+
+    DataStore::DS_CtorObj res;
+    size_t const          rowCount = wholeJson.begin()->size();
+    for (auto &[key, arr] : wholeJson.items()) {
+        if (not arr.is_array()) { return std::unexpected(incerr_c::make(JSON_topLevelEleNotArrayOrObject)); }
+        if (arr.size() != rowCount) { return std::unexpected(incerr_c::make(JSON_objectsNotOfSameSize)); }
+        if (not opts.is_projected(key)) { continue; }
+
+        // Any float value makes the whole column double
+        auto const firstVal = std::ranges::find_if(arr, [](NLMjson const &val) {
+            return not(val.is_null() || (val.is_string() && val.get_ref<std::string const &>().empty()));
+        });
+        auto       col        = DataStore::varCol_t(std::vector<long long>());
+        bool const isHintedLL = opts.get_schemaHint(key) == ColumnHint::ll_like;
+        if (auto hinted = make_hintedColumn(opts, key); hinted.has_value()) { col = std::move(hinted.value()); }
+        else if (firstVal != arr.end() && firstVal->is_string()) { col = std::vector<std::string>(); }
+        else if (std::ranges::any_of(arr, [](NLMjson const &val) { return val.is_number_float(); })) {
+            col = std::vector<double>();
+        }
+        Bitmap flags;
+        flags.reserve(rowCount);
+
+        auto visi = [&](auto &colVec) -> std::expected<void, incerr_c> {
+            using col_t = std::remove_cvref_t<decltype(colVec)>::value_type;
+            colVec.reserve(rowCount);
+
+            for (auto &val : arr) {
+                bool const isNullLike = val.is_null() || (val.is_string() && val.get_ref<std::string &>().empty());
+                if (isNullLike) {
+                    colVec.push_back(col_t{});
+                    flags.push_back(0b1);
+                    continue;
+                }
+                if (not val.is_primitive()) { return std::unexpected(incerr_c::make(JSON_unhandledCellType)); }
+                if (val.is_string() != std::same_as<col_t, std::string>) {
+                    return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+                }
+                if (isHintedLL && not is_exactLongLong(val)) {
+                    return std::unexpected(incerr_c::make(JSON_valueTypeDoesntMatch));
+                }
+                if constexpr (std::same_as<col_t, std::string>) {
+                    colVec.push_back(std::move(val.get_ref<std::string &>()));
+                }
+                else if constexpr (std::is_arithmetic_v<col_t>) { colVec.push_back(val.template get<col_t>()); }
+                flags.push_back(0b0);
+            }
+            return {};
+        };
+
+        if (auto const parsed = std::visit(visi, col); not parsed.has_value()) {
+            return std::unexpected(parsed.error());
+        }
+
+        res.data.push_back(std::make_pair(key, std::move(col)));
+        res.itemFlags.push_back(std::move(flags));
+    }
+    return res;
+}
+
+// Whole column is assessed before anything is converted, so (unlike in 'parse_delimitedRows') there is no promoting
+// String columns therefore always hold the cells exactly as they are in the input
+std::pair<DataStore::varCol_t, Bitmap> Parser::convert_fields(DataStore::FieldIndex const &fieldIndex) {
+    std::vector<TypedCell> typedCells;
+    typedCells.reserve(fieldIndex.size());
+    CellType colCellType = CellType::null_like;
+    if (fieldIndex.typeHint.has_value()) {
+        // Errors can't be reported on access, so cells of a hinted column which don't convert are null instead
+        colCellType = fieldIndex.typeHint == parsedVal_t::double_like   ? CellType::double_like
+                      : fieldIndex.typeHint == parsedVal_t::signed_like ? CellType::ll_like
+                                                                        : CellType::string_like;
+        for (size_t rowID = 0; rowID < fieldIndex.size(); ++rowID) {
+            typedCells.push_back(convert_hintedCell(fieldIndex.get_field(rowID), colCellType).value_or(TypedCell{}));
+        }
+    }
+    else {
+        for (size_t rowID = 0; rowID < fieldIndex.size(); ++rowID) {
+            typedCells.push_back(assess_typedCell(fieldIndex.get_field(rowID)));
+            colCellType = widen_cellType(colCellType, typedCells.back().type);
+        }
+    }
+
+    Bitmap itemFlags;
+    itemFlags.reserve(typedCells.size());
+    for (auto const &typedCell : typedCells) {
+        itemFlags.push_back(typedCell.type == CellType::null_like ? 0b1 : 0b0);
+    }
+
+    auto convert = [&]<typename T>(std::vector<T> &&res) -> DataStore::varCol_t {
+        res.reserve(typedCells.size());
+        for (size_t rowID = 0; auto const &typedCell : typedCells) {
+            if constexpr (std::same_as<T, double>) {
+                if (typedCell.type == CellType::null_like) { res.push_back(0.0); }
+                else if (typedCell.type == CellType::ll_like) { res.push_back(static_cast<double>(typedCell.llVal)); }
+                else { res.push_back(typedCell.dblVal); }
+            }
+            else if constexpr (std::same_as<T, long long>) {
+                res.push_back(typedCell.type == CellType::null_like ? 0ll : typedCell.llVal);
+            }
+            else { res.push_back(T(fieldIndex.get_field(rowID))); }
+            ++rowID;
+        }
+        return std::move(res);
+    };
+
+    switch (colCellType) {
+        case CellType::double_like: return {convert(std::vector<double>()), std::move(itemFlags)};
+        case CellType::string_like:
+            if (fieldIndex.zeroCopyStrings) { return {convert(std::vector<std::string_view>()), std::move(itemFlags)}; }
+            return {convert(std::vector<std::string>()), std::move(itemFlags)};
+        default: return {convert(std::vector<long long>()), std::move(itemFlags)};
+    }
+    std::unreachable();
+}
+
 // CSV AND TSV
-std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_CSV(std::string_view const sv_like) {
-    return parse_usingCSV2(csv2::Reader<csv2::delimiter<','>, csv2::quote_character<'"'>,
-                                        csv2::first_row_is_header<true>, csv2::trim_policy::trim_whitespace>{},
-                           sv_like);
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_CSV(std::string_view const sv_like,
+                                                                 ParseOptions const    &opts) {
+    return parse_delimited<','>(sv_like, opts);
 }
 
-std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_TSV(std::string_view const sv_like) {
-    return parse_usingCSV2(csv2::Reader<csv2::delimiter<'\t'>, csv2::quote_character<'"'>,
-                                        csv2::first_row_is_header<true>, csv2::trim_policy::trim_whitespace>{},
-                           sv_like);
+std::expected<DataStore::DS_CtorObj, incerr_c> Parser::parse_TSV(std::string_view const sv_like,
+                                                                 ParseOptions const    &opts) {
+    return parse_delimited<'\t'>(sv_like, opts);
+}
+
+// FOLLOW MODE
+std::optional<Follower::FileIdentity> Follower::get_fileIdentity(std::string const &path) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(std::filesystem::path(path).c_str(), 0,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { return std::nullopt; }
+
+    BY_HANDLE_FILE_INFORMATION info;
+    bool const                 gotInfo = GetFileInformationByHandle(file, &info);
+    CloseHandle(file);
+    if (not gotInfo) { return std::nullopt; }
+    return FileIdentity{
+        .device = info.dwVolumeSerialNumber,
+        .inode  = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | static_cast<uint64_t>(info.nFileIndexLow)};
+#else
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) { return std::nullopt; }
+    return FileIdentity{.device = static_cast<uint64_t>(st.st_dev), .inode = static_cast<uint64_t>(st.st_ino)};
+#endif
+}
+
+std::expected<size_t, incerr_c> Follower::poll() {
+    // Identity is taken before opening, a file rotated in between is then caught by the next poll
+    auto const    fileIdentity = get_fileIdentity(m_path);
+    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+    if (not file.is_open()) { return std::unexpected(incerr_c::make(FOLLOW_cannotReadFile)); }
+    size_t const fileSize = static_cast<size_t>(file.tellg());
+
+    bool const isRotated = fileIdentity.has_value() && m_fileIdentity.has_value() && fileIdentity != m_fileIdentity;
+    if (isRotated || fileSize < m_consumedBytes) {
+        m_state         = Parser::StreamState{};
+        m_consumedBytes = 0;
+    }
+    m_fileIdentity = fileIdentity;
+    if (fileSize == m_consumedBytes) { return 0uz; }
+
+    size_t const rowsBefore = m_state.res.has_value() ? m_state.res->get_rowCount() : 0uz;
+
+    auto get_rowsAppended = [&]() -> size_t {
+        size_t const rowsAfter = m_state.res.has_value() ? m_state.res->get_rowCount() : 0uz;
+        return rowsAfter > rowsBefore ? rowsAfter - rowsBefore : 0uz;
+    };
+
+    // Second pass happens only when the appended bytes turn out to be input that can't be parsed in parts
+    while (true) {
+        if (m_state.wholeInputMode) {
+            std::string whole(fileSize, '\0');
+            if (not file.seekg(0).read(whole.data(), static_cast<std::streamsize>(fileSize))) {
+                return std::unexpected(incerr_c::make(FOLLOW_cannotReadFile));
+            }
+            auto parsed = Parser::parse(whole);
+            if (not parsed.has_value()) { return std::unexpected(parsed.error()); }
+            m_state.res     = std::move(parsed.value());
+            m_consumedBytes = fileSize;
+            return get_rowsAppended();
+        }
+
+        // Just the appended bytes are read, the incomplete last row is left for the next poll
+        std::string pending(fileSize - m_consumedBytes, '\0');
+        file.seekg(static_cast<std::streamoff>(m_consumedBytes));
+        if (not file.read(pending.data(), static_cast<std::streamsize>(pending.size()))) {
+            return std::unexpected(incerr_c::make(FOLLOW_cannotReadFile));
+        }
+
+        size_t const cutAt = Parser::get_completeRowsSize(m_state, pending, m_state.res.has_value() ? 1uz : 2uz);
+        if (cutAt == 0) { return 0uz; }
+
+        auto partRes = Parser::parse_streamPart(m_state, std::string_view(pending).substr(0, cutAt));
+        if (not partRes.has_value()) {
+            // Rejected rows are skipped (the error is reported just once) so that the rows after them still get parsed
+            // Without any rows parsed yet there is no schema to go on with, the file has to be replaced first
+            if (m_state.res.has_value()) { m_consumedBytes += cutAt; }
+            return std::unexpected(partRes.error());
+        }
+        if (not m_state.wholeInputMode) {
+            m_consumedBytes += cutAt;
+            return get_rowsAppended();
+        }
+    }
 }
 
 } // namespace parsers
@@ -286,7 +286,7 @@ guess_rt BarV::guess_TSCol(guess_firstParamType &&dp_pr, DataStore const &ds) {
         std::optional<std::pair<size_t, size_t>> locRes = std::nullopt;
 
         for (size_t i = 0; i < std::min(ds.m_data.size(), dp.m_colAssessments.size()); ++i) {
-            bool const stringLike = ds.m_data.at(i).colType == parsedVal_t::string_like;
+            bool const stringLike = ds.m_data.at(i).get_colType() == parsedVal_t::string_like;
             bool const tsLike     = dp.m_colAssessments.at(i).is_timeSeriesLikeIndex;
             bool const notSelectedElsewhere =
                 (dp.cat_colID.has_value() ? i != dp.cat_colID.value() : true) &&
@@ -354,8 +354,8 @@ guess_rt BarV::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &ds
     if (dp.values_colIDs.size() > 1) { return std::unexpected(incerr_c::make(GVC_selectedMoreThan1YvalColForBarV)); }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
                                  (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
@@ -455,8 +455,8 @@ guess_rt BarVM::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &d
     }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
                                  (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
@@ -532,7 +532,7 @@ guess_rt Scatter::guess_TSCol(guess_firstParamType &&dp_pr, DataStore const &ds)
         for (size_t i = 0; i < std::min(ds.m_data.size(), dp.m_colAssessments.size()); ++i) {
             if ((not dp.m_colAssessments.at(i).is_timeSeriesLikeIndex) &&
                 (dp.cat_colID.has_value() ? i != dp.cat_colID.value() : true) &&
-                (ds.m_data.at(i).colType != parsedVal_t::string_like) &&
+                (ds.m_data.at(i).get_colType() != parsedVal_t::string_like) &&
                 std::ranges::none_of(dp.values_colIDs, [&](auto const &a) { return a == i; })) {
 
                 dp.labelTS_colID = i;
@@ -606,8 +606,8 @@ guess_rt Scatter::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const
     }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
                                  (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
@@ -717,8 +717,8 @@ guess_rt Multiline::guess_valueCols(guess_firstParamType &&dp_pr, DataStore cons
     }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
 
@@ -759,8 +759,7 @@ guess_rt Multiline::guess_TFfeatures(guess_firstParamType &&dp_pr, DataStore con
 
 std::pair<incom::terminal_plot::DesiredPlot, size_t> Multiline::compute_priorityFactor(
     incom::terminal_plot::DesiredPlot &&dp_pr, DataStore const &ds) {
-    size_t rawRowCount =
-        std::visit([](auto const &vec) { return vec.size(); }, ds.m_data.at(dp_pr.values_colIDs.front()).variant_data);
+    size_t rawRowCount = ds.m_data.at(dp_pr.values_colIDs.front()).get_rowCount();
     long long const available_areaWidth =
         dp_pr.targetWidth.value() - Config::ps_padLeft - Config::ps_padRight - 2ll - Config::max_valLabelSize -
         Config::axisLabels_padRight_vl -
@@ -789,8 +788,8 @@ guess_rt BarHM::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &d
     }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
                                  (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
@@ -826,8 +825,8 @@ guess_rt BarHM::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &d
 guess_rt BarHM::guess_sizes(guess_firstParamType &&dp_pr, DataStore const &ds) {
     DesiredPlot &dp = dp_pr.get();
 
-    // rowCount are the unfiltered row (filterFlag == 0u)
-    size_t const rowCount = std::ranges::count(dp.filterFlags, 0u);
+    // rowCount are the unfiltered rows
+    size_t const rowCount = dp.filterFlags.get_unfilteredCount();
 
     size_t const desired_areaWidth =
         ((rowCount * dp.values_colIDs.size()) + (dp.values_colIDs.size() == 1 ? rowCount - 1 : 2 * rowCount));
@@ -904,8 +903,8 @@ guess_rt BarHS::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &d
     }
 
     auto lam_filter = [&](auto const &tpl) {
-        bool const arithmeticCol = std::get<1>(tpl).colType == parsedVal_t::signed_like ||
-                                   std::get<1>(tpl).colType == parsedVal_t::double_like;
+        bool const arithmeticCol = std::get<1>(tpl).get_colType() == parsedVal_t::signed_like ||
+                                   std::get<1>(tpl).get_colType() == parsedVal_t::double_like;
         // Not timeSeriesLike and Not categoryLike
         bool const notExcluded = (dp.cat_colID.has_value() ? (std::get<0>(tpl) != dp.cat_colID.value()) : true) &&
                                  (dp.labelTS_colID.has_value() ? (std::get<0>(tpl) != dp.labelTS_colID.value()) : true);
@@ -942,8 +941,8 @@ guess_rt BarHS::guess_valueCols(guess_firstParamType &&dp_pr, DataStore const &d
 guess_rt BarHS::guess_sizes(guess_firstParamType &&dp_pr, DataStore const &ds) {
     DesiredPlot &dp = dp_pr.get();
 
-    // rowCount are the unfiltered row (filterFlag == 0u)
-    size_t const rowCount = std::ranges::count(dp.filterFlags, 0u);
+    // rowCount are the unfiltered rows
+    size_t const rowCount = dp.filterFlags.get_unfilteredCount();
 
     size_t const desired_areaWidth = (2 * rowCount) - 1;
 
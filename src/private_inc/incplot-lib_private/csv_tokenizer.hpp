@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <incplot-lib_private/simd_scan.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+namespace detail {
+
+// Vectorized tokenizer of CSV/TSV input
+// Input is processed in blocks of 64 bytes, for each block bitmasks of delimiters, quotes and newlines are computed at
+// once (see simd_scan.hpp)
+// Delimiters and newlines inside of quotes are masked out using 'prefix XOR' of the quote mask
+// Fields are reported as views into the input, trimmed of ' ', '\t' and '\r' (quotes are kept, same as csv2 did)
+namespace csv_tokenizer {
+
+using simd_scan::blockSize;
+
+struct BlockMasks {
+    uint64_t delim;
+    uint64_t quote;
+    uint64_t newLine;
+};
+
+template <char delim>
+inline BlockMasks compute_masks(char const *block) {
+    simd_scan::Block const loaded = simd_scan::load_block(block);
+    return BlockMasks{simd_scan::mask_eq(loaded, delim), simd_scan::mask_eq(loaded, '"'),
+                      simd_scan::mask_eq(loaded, '\n')};
+}
+
+constexpr inline std::string_view trim_field(std::string_view sv) {
+    auto is_trimChar = [](char const chr) { return chr == ' ' || chr == '\t' || chr == '\r'; };
+    while (not sv.empty() && is_trimChar(sv.front())) { sv.remove_prefix(1); }
+    while (not sv.empty() && is_trimChar(sv.back())) { sv.remove_suffix(1); }
+    return sv;
+}
+
+// Calls 'on_field(colID, fieldView)' for every field and 'on_rowEnd(fieldCount)' at the end of every row
+// Tokenizing stops early when 'on_rowEnd' returns false
+// Newlines inside of quotes do not end the row
+template <char delim>
+inline void tokenize(std::string_view const input, auto &&on_field, auto &&on_rowEnd) {
+    if (input.empty()) { return; }
+
+    size_t   fieldBeg = 0, colID = 0;
+    uint64_t inQuotesCarry = 0; // All ones if the previous block ended inside quotes
+
+    // Returns false when tokenizing should stop
+    auto process_structural = [&](size_t const blockBeg, uint64_t structural, uint64_t const newLines) -> bool {
+        while (structural != 0) {
+            size_t const bitID = std::countr_zero(structural);
+            size_t const pos   = blockBeg + bitID;
+            on_field(colID++, trim_field(input.substr(fieldBeg, pos - fieldBeg)));
+            fieldBeg = pos + 1;
+            if ((newLines >> bitID) & 1) {
+                if (not on_rowEnd(colID)) { return false; }
+                colID = 0;
+            }
+            structural &= structural - 1;
+        }
+        return true;
+    };
+
+    auto process_block = [&](char const *block, size_t const blockBeg) -> bool {
+        BlockMasks const masks    = compute_masks<delim>(block);
+        uint64_t const   inQuotes = simd_scan::prefix_xor(masks.quote) ^ inQuotesCarry;
+        inQuotesCarry             = static_cast<uint64_t>(static_cast<int64_t>(inQuotes) >> 63);
+
+        uint64_t const newLines = masks.newLine & ~inQuotes;
+        return process_structural(blockBeg, (masks.delim & ~inQuotes) | newLines, newLines);
+    };
+
+    size_t blockBeg = 0;
+    for (; blockBeg + blockSize <= input.size(); blockBeg += blockSize) {
+        if (not process_block(input.data() + blockBeg, blockBeg)) { return; }
+    }
+
+    // Last partial block is padded with zeros (which are never structural)
+    if (blockBeg < input.size()) {
+        char padded[blockSize] = {};
+        std::memcpy(padded, input.data() + blockBeg, input.size() - blockBeg);
+        if (not process_block(padded, blockBeg)) { return; }
+    }
+
+    // Last row without newline at the end
+    if (fieldBeg < input.size() || colID > 0) {
+        on_field(colID++, trim_field(input.substr(fieldBeg)));
+        on_rowEnd(colID);
+    }
+}
+
+} // namespace csv_tokenizer
+} // namespace detail
+} // namespace terminal_plot
+} // namespace incom
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <incplot-lib/err.hpp>
+#include <incplot-lib/parsers_inc.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+namespace detail {
+
+// Transparent decompression of compressed input, recognized by the magic bytes at its very beginning
+// gzip needs zlib and zstd needs libzstd at build time (see 'INCPLOT_LIB_HAS_ZLIB' and 'INCPLOT_LIB_HAS_ZSTD')
+namespace decompress {
+
+using incerr_c      = incerr::incerr_code;
+using chunkReader_t = parsers::Parser::chunkReader_t;
+
+enum class Codec {
+    none,
+    gzip,
+    zstd
+};
+
+constexpr inline size_t magicSize = 4;
+
+// Only needs the first 'magicSize' bytes of the input
+Codec detect_codec(std::string_view const head);
+// Whether the codec was available at build time
+bool  is_codecAvailable(Codec const codec);
+
+// Reader of input that might be compressed, yields the decompressed bytes (input not compressed is passed as is)
+// Compressed input is decompressed in chunks of 'Config::parser_streamChunkSize' on a separate thread, at most
+// 'Config::parser_decompressAheadChunks' chunks ahead of the consumer, so decompression and parsing overlap
+class TransparentReader {
+private:
+    chunkReader_t m_rawReader;
+    Codec         m_codec = Codec::none;
+    // Bytes read to recognize the codec, these are the first to be decompressed (or passed through)
+    std::string   m_head;
+    size_t        m_headConsumed = 0;
+
+    // Handoff of decompressed chunks between the decompressing thread and the consumer
+    mutable std::mutex          m_mutex;
+    std::condition_variable_any m_cv;
+    std::deque<std::string>     m_ready;
+    bool                        m_producerDone = false;
+    std::optional<incerr_c>     m_error        = std::nullopt;
+
+    // Accessed by the consumer only
+    std::string m_current;
+    size_t      m_currentConsumed = 0;
+
+    // Declared last so that it is stopped and joined before anything it uses is destroyed
+    std::jthread m_producer;
+
+    size_t read_raw(std::span<char> const buf);
+    void   run_producer(std::stop_token const stopToken);
+    // Returns false when the producer is requested to stop
+    bool   push_chunk(std::stop_token const &stopToken, std::string &&chunk);
+
+public:
+    explicit TransparentReader(chunkReader_t rawReader);
+
+    TransparentReader(TransparentReader const &)            = delete;
+    TransparentReader &operator=(TransparentReader const &) = delete;
+
+    // Same contract as 'chunkReader_t', returning 0 signals the end of input (or an error, see 'get_error')
+    size_t read(std::span<char> const buf);
+
+    Codec                   get_codec() const { return m_codec; }
+    // Corrupted or truncated compressed input (or codec not available), complete only once 'read' returned 0
+    std::optional<incerr_c> get_error() const;
+};
+
+} // namespace decompress
+} // namespace detail
+} // namespace terminal_plot
+} // namespace incom
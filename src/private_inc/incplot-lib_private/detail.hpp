@@ -6,8 +6,10 @@
 #include <functional>
 #include <iterator>
 #include <ranges>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <incplot-lib_private/color_mixer.hpp>
 #include <ww898/utf_converters.hpp>
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+
+namespace incom {
+namespace terminal_plot {
+namespace detail {
+
+// Number parsing that doesn't depend on the platform's floating-point std::from_chars (missing from some libc++)
+namespace parse_number {
+
+// Case insensitive comparison with 'lowerCase' (which must be all lower case)
+constexpr inline bool is_equalNoCase(std::string_view const sv, std::string_view const lowerCase) {
+    if (sv.size() != lowerCase.size()) { return false; }
+    for (size_t i = 0; i < sv.size(); ++i) {
+        char const chr = (sv[i] >= 'A' && sv[i] <= 'Z') ? static_cast<char>(sv[i] - 'A' + 'a') : sv[i];
+        if (chr != lowerCase[i]) { return false; }
+    }
+    return true;
+}
+
+// Locale independent (and so thread-safe) parsing of decimal floating point numbers
+// Accepts the same 'general' format as std::from_chars: [-]digits[.digits][(e|E)[+|-]digits]
+// Same as std::from_chars also accepts [-]inf, [-]infinity, [-]nan and [-]nan(chars) in any case
+// Clinger's fast path: mantissa of at most 2^53 and power of ten of at most 22 is exact in double arithmetic
+// Anything outside of that goes through a stream imbued with the classic locale
+// Values too small to be represented (non-zero digits rounding to zero) are rejected, as by std::from_chars
+inline bool parse_doubleLocaleFree(std::string_view sv, double &out) {
+    constexpr std::array<double, 23> pow10{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    auto const isDigit = [](char const chr) { return chr >= '0' && chr <= '9'; };
+
+    size_t   pos = 0;
+    bool     neg = false, exact = true, anyDigit = false;
+    uint64_t mant   = 0;
+    int      digits = 0;
+    long     exp10  = 0;
+
+    if (pos < sv.size() && sv[pos] == '-') {
+        neg = true;
+        ++pos;
+    }
+
+    // Special values
+    if (std::string_view const rest = sv.substr(pos); not rest.empty() && not isDigit(rest.front())) {
+        if (is_equalNoCase(rest, "inf") || is_equalNoCase(rest, "infinity")) {
+            out = neg ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+            return true;
+        }
+        bool isNaN = is_equalNoCase(rest, "nan");
+        if (not isNaN && rest.size() > 4 && is_equalNoCase(rest.substr(0, 4), "nan(") && rest.back() == ')') {
+            isNaN = true;
+            for (char const chr : rest.substr(4, rest.size() - 5)) {
+                if (not(isDigit(chr) || (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || chr == '_')) {
+                    isNaN = false;
+                }
+            }
+        }
+        if (isNaN) {
+            out = neg ? -std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::quiet_NaN();
+            return true;
+        }
+    }
+
+    auto add_digit = [&](char const chr, bool const isFraction) {
+        anyDigit = true;
+        if (mant == 0 && chr == '0') {
+            if (isFraction) { --exp10; }
+            return;
+        }
+        if (digits < 19) {
+            mant = mant * 10 + static_cast<uint64_t>(chr - '0');
+            ++digits;
+            if (isFraction) { --exp10; }
+        }
+        else {
+            if (chr != '0') { exact = false; }
+            if (not isFraction) { ++exp10; }
+        }
+    };
+    for (; pos < sv.size() && isDigit(sv[pos]); ++pos) { add_digit(sv[pos], false); }
+    if (pos < sv.size() && sv[pos] == '.') {
+        for (++pos; pos < sv.size() && isDigit(sv[pos]); ++pos) { add_digit(sv[pos], true); }
+    }
+    if (not anyDigit) { return false; }
+
+    if (pos < sv.size() && (sv[pos] == 'e' || sv[pos] == 'E')) {
+        ++pos;
+        bool expNeg = false;
+        if (pos < sv.size() && (sv[pos] == '-' || sv[pos] == '+')) { expNeg = sv[pos++] == '-'; }
+        if (pos == sv.size() || not isDigit(sv[pos])) { return false; }
+
+        long expVal = 0;
+        for (; pos < sv.size() && isDigit(sv[pos]); ++pos) {
+            if (expVal < 100'000) { expVal = expVal * 10 + (sv[pos] - '0'); }
+        }
+        exp10 += expNeg ? -expVal : expVal;
+    }
+    if (pos != sv.size()) { return false; }
+
+    if (exact && mant <= (1ull << 53) && exp10 >= -22 && exp10 <= 22) {
+        double const val = static_cast<double>(mant);
+        out              = exp10 < 0 ? val / pow10[-exp10] : val * pow10[exp10];
+        if (neg) { out = -out; }
+        return true;
+    }
+
+    std::istringstream iss{std::string(sv)};
+    iss.imbue(std::locale::classic());
+    iss >> out;
+    // Underflow comes out of the stream as 0 without setting 'failbit'
+    return not iss.fail() && not(out == 0.0 && mant != 0);
+}
+
+} // namespace parse_number
+} // namespace detail
+} // namespace terminal_plot
+} // namespace incom
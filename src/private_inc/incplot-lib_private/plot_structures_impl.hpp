@@ -144,28 +144,26 @@ auto Base::build_self(this auto &self) -> compute_rt<decltype(self)> {
 // BAR V
 auto BarV::initialize_data_views(this auto &&self) -> compute_rt<decltype(self)> {
 
-    if (self.dp.labelTS_colID.has_value()) {
-        auto dataView = self.ds.get_filteredViewOfData(self.dp.labelTS_colID.value(), self.dp.filterFlags);
+    // Positions of the rows left after filtering, all the columns are gathered through it
+    // Gathering knows the count of rows upfront (instead of filtering each column row by row)
+    auto const selection = self.dp.filterFlags.combined.get_selection();
 
-        auto create_LOC_storage = [&](auto &var) { self.labelTS_data = std::ranges::to<std::vector>(var); };
-        std::visit(create_LOC_storage, dataView);
+    if (self.dp.labelTS_colID.has_value()) {
+        self.labelTS_data = self.ds.get_gatheredData(self.dp.labelTS_colID.value(), selection);
     }
     else { return std::unexpected(incerr_c::make(INI_labelTS_colID_isNull)); }
 
     if (self.dp.cat_colID.has_value()) {
-        auto dataView = self.ds.get_filteredViewOfData(self.dp.cat_colID.value(), self.dp.filterFlags);
+        self.cat_data = self.ds.get_gatheredData(self.dp.cat_colID.value(), selection);
 
-        auto create_LOC_storage = [&](auto &var) { self.cat_data = std::ranges::to<std::vector>(var); };
-        std::visit(create_LOC_storage, dataView);
+        if (auto const &catDict = self.ds.m_data.at(self.dp.cat_colID.value()).get_catDict(); catDict.has_value()) {
+            self.cat_dict = catDict->get_selected(selection);
+        }
     }
 
     if (self.dp.values_colIDs.size() == 0) { return std::unexpected(incerr_c::make(INI_values_colIDs_isEmpty)); }
     else {
-        auto dataViews = self.ds.get_filteredViewOfData(self.dp.values_colIDs, self.dp.filterFlags);
-        for (auto &viewRef : dataViews) {
-            auto create_LOC_storage = [&](auto &var) { self.values_data.push_back(std::ranges::to<std::vector>(var)); };
-            std::visit(create_LOC_storage, viewRef);
-        }
+        self.values_data = self.ds.get_gatheredData(self.dp.values_colIDs, selection);
         // Compute row count once so it is not required ad-hoc
         self.data_rowCount = std::visit([&](auto &&varVec) { return varVec.size(); }, self.values_data.at(0));
         if (self.data_rowCount == 0) { return std::unexpected(incerr_c::make(INI_values_rowCount_isZero)); }
@@ -213,7 +211,8 @@ auto BarV::compute_descriptors(this auto &&self) -> compute_rt<decltype(self)> {
                 }
             };
 
-            auto   catIDs_vec = std::visit(create_catIDs_vec, self.cat_data.value());
+            auto   catIDs_vec = self.cat_dict.has_value() ? self.cat_dict->get_sortedCategories()
+                                                              : std::visit(create_catIDs_vec, self.cat_data.value());
             size_t maxSize =
                 std::ranges::max(std::views::transform(catIDs_vec, [](auto const &a) { return a.size(); }));
             self.labels_verRightWidth = std::min(maxSize, Config::axisLabels_maxLength_vr);
@@ -589,29 +588,27 @@ auto BarV::compute_plot_area(this auto &&self) -> compute_rt<decltype(self)> {
 }
 
 auto BarV::compute_footer(this auto &&self) -> compute_rt<decltype(self)> {
+    // Input was sampled down to the row budget while parsing
+    if (self.ds.m_sourceRowCount.has_value() && self.ds.m_sourceRowCount.value() != 0) {
+        size_t const rowCount    = self.ds.get_rowCount();
+        size_t const sourceCount = self.ds.m_sourceRowCount.value();
+        self.footer.push_back(std::format("\nNote:\nPlotted a sample of {} out of {} rows (1 in {:.1f}).\n", rowCount,
+                                          sourceCount, static_cast<double>(sourceCount) / std::max(rowCount, 1uz)));
+    }
+
     if ((not self.dp.display_filtered_bool.has_value()) || self.dp.display_filtered_bool.value() == false) {
         return std::ref(self);
     }
 
-    auto filteredCount = std::ranges::count_if(self.dp.filterFlags, [](auto const &ff) { return ff != 0; });
-    if (filteredCount == 0) { return std::ref(self); }
+    if (self.dp.filterFlags.get_filteredCount() == 0) { return std::ref(self); }
 
     std::string res1{};
-    if (std::ranges::any_of(self.dp.filterFlags, [](auto const &ff) { return ff & 0b1; })) {
+    if (self.dp.filterFlags.nulls.any()) {
         res1.push_back('\n');
         res1.append("Warning:\n");
         res1.append("The following rows were filtered out because they contained 'null' values:\n");
 
-        auto enumerated = std::views::transform(self.dp.filterFlags,
-                                                [ij = 0uz](auto const &item) mutable {
-                                                    return std::tuple_cat(std::make_tuple(ij++), std::tie(item));
-                                                }) |
-                          std::ranges::to<std::vector>();
-
-        auto viewOfFiltered = std::views::filter(enumerated, [](auto const &pr) { return std::get<1>(pr) & 0b1; }) |
-                              std::views::transform([](auto const &pr2) { return std::get<0>(pr2); });
-
-        for (auto const &f_item : viewOfFiltered) {
+        for (auto const f_item : self.dp.filterFlags.nulls.get_setPositions()) {
             res1.append(std::to_string(f_item));
             res1.push_back(',');
             res1.push_back(' ');
@@ -622,22 +619,14 @@ auto BarV::compute_footer(this auto &&self) -> compute_rt<decltype(self)> {
         self.footer.push_back(res1);
         res1.clear();
     }
-    if (std::ranges::any_of(self.dp.filterFlags, [](auto const &ff) { return ff & 0b10; })) {
+    if (self.dp.filterFlags.outsideStdDev.any()) {
         res1.append("\n");
         res1.append("Warning:\n");
         res1.append(std::format(
             "The following rows were filtered out because they contained extreme values outside {}σ from mean:\n",
             self.dp.filter_outsideStdDev.value()));
 
-        auto enumerated = std::views::transform(self.dp.filterFlags,
-                                                [ij = 0uz](auto const &item) mutable {
-                                                    return std::tuple_cat(std::make_tuple(ij++), std::tie(item));
-                                                }) |
-                          std::ranges::to<std::vector>();
-
-        auto viewOfFiltered = std::views::filter(enumerated, [](auto const &pr) { return std::get<1>(pr) & 0b10; }) |
-                              std::views::transform([](auto const &pr2) { return std::get<0>(pr2); });
-        for (auto const &f_item : viewOfFiltered) {
+        for (auto const f_item : self.dp.filterFlags.outsideStdDev.get_setPositions()) {
             res1.append(std::to_string(f_item));
             res1.push_back(',');
             res1.push_back(' ');
@@ -1008,7 +997,8 @@ auto Scatter::compute_labels_vr(this auto &&self) -> compute_rt<decltype(self)>
                 return res;
             }
         };
-        auto uniquedCats_vec = std::visit(create_catIDs_vec, self.cat_data.value());
+        auto uniquedCats_vec = self.cat_dict.has_value() ? self.cat_dict->get_sortedCategories()
+                                                         : std::visit(create_catIDs_vec, self.cat_data.value());
         // horTop axis line
         self.labels_verRight.push_back(
             std::string(self.labels_verRightWidth + Config::axisLabels_padLeft_vr, Config::space));
@@ -1139,7 +1129,9 @@ auto Scatter::compute_plot_area(this auto &&self) -> compute_rt<decltype(self)>
             return catIDs_vec;
         };
 
-        opt_catIDs_vec = std::visit(create_catIDs_vec, self.cat_data.value());
+        // Dictionary encoded categories map to their IDs directly (without searching for every row)
+        if (self.cat_dict.has_value()) { opt_catIDs_vec = self.cat_dict->get_sortedIDs(); }
+        else { opt_catIDs_vec = std::visit(create_catIDs_vec, self.cat_data.value()); }
     }
 
     self.plotArea =
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INCPLOT_LIB_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace incom {
+namespace terminal_plot {
+namespace detail {
+
+// Byte scanning primitives working on blocks of 64 bytes
+// Comparing a block against a character yields a 64 bit mask (bit 'i' set if byte 'i' is equal)
+// AVX2 or SSE2 when available, portable SWAR (SIMD within a register) otherwise (ARM, etc.)
+namespace simd_scan {
+
+constexpr inline size_t blockSize = 64;
+
+#if defined(__AVX2__)
+struct Block {
+    __m256i lo;
+    __m256i hi;
+};
+inline Block load_block(char const *ptr) {
+    return Block{_mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr)),
+                 _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr + 32))};
+}
+inline uint64_t mask_eq(Block const &block, char const chr) {
+    __m256i const  needle = _mm256_set1_epi8(chr);
+    uint64_t const loBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block.lo, needle)));
+    uint64_t const hiBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block.hi, needle)));
+    return loBits | (hiBits << 32);
+}
+
+#elif defined(INCPLOT_LIB_SIMD_SSE2)
+struct Block {
+    __m128i parts[4];
+};
+inline Block load_block(char const *ptr) {
+    return Block{{_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr)),
+                  _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + 16)),
+                  _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + 32)),
+                  _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + 48))}};
+}
+inline uint64_t mask_eq(Block const &block, char const chr) {
+    __m128i const needle = _mm_set1_epi8(chr);
+    uint64_t      res    = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        res |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block.parts[i], needle))))
+               << (i * 16);
+    }
+    return res;
+}
+
+#else
+struct Block {
+    uint64_t words[8];
+};
+inline Block load_block(char const *ptr) {
+    Block res;
+    std::memcpy(res.words, ptr, blockSize);
+    if constexpr (std::endian::native == std::endian::big) {
+        for (auto &word : res.words) { word = std::byteswap(word); }
+    }
+    return res;
+}
+// Exact (no false positives from borrows) because the high bit of every byte is handled separately
+inline uint64_t mask_eq8(uint64_t const word, char const chr) {
+    constexpr uint64_t lo7    = 0x7F7F7F7F7F7F7F7Full;
+    uint64_t const     x      = word ^ (0x0101010101010101ull * static_cast<unsigned char>(chr));
+    uint64_t const     nonZer = ((x & lo7) + lo7) | x;
+    uint64_t const     zeroHi = ~nonZer & ~lo7; // High bit set in every byte of 'x' that is zero
+    // Gather the high bits into the low 8 bits
+    return ((zeroHi >> 7) * 0x0102040810204080ull) >> 56;
+}
+inline uint64_t mask_eq(Block const &block, char const chr) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < 8; ++i) { res |= mask_eq8(block.words[i], chr) << (i * 8); }
+    return res;
+}
+#endif
+
+// Each bit set to the XOR of itself and all lower bits
+// For a quote mask that marks all the positions 'inside' quotes (including the opening quote itself)
+constexpr inline uint64_t prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Counts occurrences of each of 'chrs' in 'sv' in a single pass
+template <char... chrs>
+inline std::array<size_t, sizeof...(chrs)> count_bytes(std::string_view const sv) {
+    std::array<size_t, sizeof...(chrs)> res{};
+
+    auto count_block = [&](char const *ptr) {
+        Block const block = load_block(ptr);
+        size_t      id    = 0;
+        ((res[id++] += std::popcount(mask_eq(block, chrs))), ...);
+    };
+
+    size_t pos = 0;
+    for (; pos + blockSize <= sv.size(); pos += blockSize) { count_block(sv.data() + pos); }
+
+    // Last partial block is padded with zeros (never counted unless counting zeros, which is not supported)
+    if (pos < sv.size()) {
+        char padded[blockSize] = {};
+        std::memcpy(padded, sv.data() + pos, sv.size() - pos);
+        count_block(padded);
+    }
+    return res;
+}
+
+} // namespace simd_scan
+} // namespace detail
+} // namespace terminal_plot
+} // namespace incom
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <incplot-lib/snapshot.hpp>
+
+
+namespace incom {
+namespace terminal_plot {
+namespace snapshot {
+
+using enum Unexp_parser;
+
+// FORMAT
+// Every part starts at an offset aligned to 8 bytes (padded with zeros), all integers are in the native byte order
+// HEADER:      magic[8] | u32 version | u32 byteOrderMark | u64 colCount | u64 rowCount | u64 sourceRowCount
+// EACH COLUMN: u64 nameSize | name | u32 colType | u32 reserved | u64 validity[(rowCount + 63) / 64] | data
+// DATA:        long long / double -> rowCount values
+//              string             -> u64 dictSize | u64 offsets[dictSize + 1] | u32 codes[rowCount] | dict bytes
+namespace {
+constexpr std::string_view magic{"INCPLTDS", 8};
+constexpr uint32_t         version        = 1;
+constexpr uint32_t         byteOrderMark  = 0x01020304;
+constexpr uint64_t         noSourceRowCnt = std::numeric_limits<uint64_t>::max();
+
+constexpr size_t get_padding(size_t const offset) { return (8 - (offset % 8)) % 8; }
+
+class Writer {
+private:
+    std::ofstream &m_out;
+    size_t         m_offset = 0;
+
+public:
+    explicit Writer(std::ofstream &out) : m_out(out) {}
+
+    void write_bytes(void const *data, size_t const size) {
+        m_out.write(static_cast<char const *>(data), static_cast<std::streamsize>(size));
+        m_offset += size;
+    }
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    void write_val(T const val) {
+        write_bytes(&val, sizeof(T));
+    }
+    void pad() {
+        constexpr char zeros[8] = {};
+        write_bytes(zeros, get_padding(m_offset));
+    }
+};
+
+// Every read is checked against the size of the input, so that a truncated or corrupted snapshot is never read past
+class Reader {
+private:
+    std::string_view m_input;
+    size_t           m_offset = 0;
+
+public:
+    explicit Reader(std::string_view const input) : m_input(input) {}
+
+    std::optional<std::string_view> read_bytes(size_t const size) {
+        if (size > m_input.size() - m_offset) { return std::nullopt; }
+        std::string_view const res = m_input.substr(m_offset, size);
+        m_offset += size;
+        return res;
+    }
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    std::optional<T> read_val() {
+        auto const bytes = read_bytes(sizeof(T));
+        if (not bytes.has_value()) { return std::nullopt; }
+        T res;
+        std::memcpy(&res, bytes->data(), sizeof(T));
+        return res;
+    }
+    // Reads 'count' values of T in one go (the count is checked before anything gets allocated)
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    std::optional<std::vector<T>> read_array(uint64_t const count) {
+        if (count > (m_input.size() - m_offset) / sizeof(T)) { return std::nullopt; }
+        std::vector<T> res(count);
+        // Data of an empty vector might be a null pointer, which memcpy must not get (even with zero size)
+        if (count > 0) { std::memcpy(res.data(), m_input.data() + m_offset, count * sizeof(T)); }
+        m_offset += count * sizeof(T);
+        return res;
+    }
+    bool skip_padding() { return read_bytes(get_padding(m_offset)).has_value(); }
+};
+
+// Validity is the inverse of the 'null' flags, so both are converted a whole word at a time
+std::vector<uint64_t> make_validity(Bitmap const &itemFlags) {
+    std::vector<uint64_t> res(itemFlags.get_words());
+    for (auto &word : res) { word = ~word; }
+    if (itemFlags.size() % 64 != 0) { res.back() &= (1ull << (itemFlags.size() % 64)) - 1; }
+    return res;
+}
+
+Bitmap make_itemFlags(std::vector<uint64_t> validity, size_t const rowCount) {
+    for (auto &word : validity) { word = ~word; }
+    return Bitmap::from_words(std::move(validity), rowCount);
+}
+} // namespace
+
+bool is_snapshot(std::string_view const head) { return head.starts_with(magic); }
+
+std::expected<void, incerr_c> save(DataStore const &ds, std::string_view const &path) {
+    std::ofstream out{std::string(path), std::ios::binary | std::ios::trunc};
+    if (not out.is_open()) { return std::unexpected(incerr_c::make(SNAPSHOT_cannotWriteFile)); }
+
+    size_t const rowCount = ds.get_rowCount();
+    Writer       writer(out);
+    writer.write_bytes(magic.data(), magic.size());
+    writer.write_val(version);
+    writer.write_val(byteOrderMark);
+    writer.write_val(static_cast<uint64_t>(ds.m_data.size()));
+    writer.write_val(static_cast<uint64_t>(rowCount));
+    writer.write_val(ds.m_sourceRowCount.has_value() ? static_cast<uint64_t>(ds.m_sourceRowCount.value())
+                                                     : noSourceRowCnt);
+
+    for (auto const &col : ds.m_data) {
+        writer.write_val(static_cast<uint64_t>(col.name.size()));
+        writer.write_bytes(col.name.data(), col.name.size());
+        writer.pad();
+        writer.write_val(static_cast<uint32_t>(col.get_colType()));
+        writer.write_val(uint32_t{0});
+
+        auto const validity = make_validity(col.get_itemFlags());
+        writer.write_bytes(validity.data(), validity.size() * sizeof(uint64_t));
+
+        auto visi = [&](auto const &colVec) {
+            using val_t = std::remove_cvref_t<decltype(colVec)>::value_type;
+            if constexpr (std::is_arithmetic_v<val_t>) {
+                writer.write_bytes(colVec.data(), colVec.size() * sizeof(val_t));
+            }
+            else {
+                // String columns always have their CatDict, it is only re-built here if that ever isn't the case
+                DataStore::CatDict localDict;
+                if (not col.get_catDict().has_value()) {
+                    for (auto const &str : colVec) { localDict.push_back(str); }
+                }
+                DataStore::CatDict const &catDict = col.get_catDict().has_value() ? col.get_catDict().value()
+                                                                                   : localDict;
+
+                writer.write_val(static_cast<uint64_t>(catDict.get_categoryCount()));
+                uint64_t offset = 0;
+                writer.write_val(offset);
+                for (size_t code = 0; code < catDict.get_categoryCount(); ++code) {
+                    offset += catDict.get_category(static_cast<uint32_t>(code)).size();
+                    writer.write_val(offset);
+                }
+                writer.write_bytes(catDict.codes.data(), catDict.codes.size() * sizeof(uint32_t));
+                writer.pad();
+                for (size_t code = 0; code < catDict.get_categoryCount(); ++code) {
+                    std::string const &category = catDict.get_category(static_cast<uint32_t>(code));
+                    writer.write_bytes(category.data(), category.size());
+                }
+            }
+            writer.pad();
+        };
+        std::visit(visi, col.get_variantData());
+    }
+
+    out.flush();
+    if (not out.good()) { return std::unexpected(incerr_c::make(SNAPSHOT_cannotWriteFile)); }
+    return {};
+}
+
+std::expected<DataStore, incerr_c> load(std::string_view const &path) {
+    auto inputBuffer = InputBuffer::map_file(path);
+    if (not inputBuffer.has_value()) { return std::unexpected(incerr_c::make(SNAPSHOT_cannotReadFile)); }
+    return load(std::make_shared<InputBuffer const>(std::move(inputBuffer.value())));
+}
+
+std::expected<DataStore, incerr_c> load(std::shared_ptr<InputBuffer const> const &inputBuffer) {
+    auto const invalid = std::unexpected(incerr_c::make(SNAPSHOT_invalidFormat));
+    Reader     reader(inputBuffer->get_view());
+
+    if (reader.read_bytes(magic.size()) != magic) { return invalid; }
+    if (reader.read_val<uint32_t>() != version) { return invalid; }
+    if (reader.read_val<uint32_t>() != byteOrderMark) { return invalid; }
+    auto const colCount       = reader.read_val<uint64_t>();
+    auto const rowCount       = reader.read_val<uint64_t>();
+    auto const sourceRowCount = reader.read_val<uint64_t>();
+    if (not colCount.has_value() || not rowCount.has_value() || not sourceRowCount.has_value()) { return invalid; }
+
+    DataStore res;
+    if (sourceRowCount.value() != noSourceRowCnt) { res.m_sourceRowCount = sourceRowCount.value(); }
+
+    for (uint64_t colID = 0; colID < colCount.value(); ++colID) {
+        auto const nameSize = reader.read_val<uint64_t>();
+        if (not nameSize.has_value()) { return invalid; }
+        auto const name = reader.read_bytes(nameSize.value());
+        if (not name.has_value() || not reader.skip_padding()) { return invalid; }
+
+        auto const colType = reader.read_val<uint32_t>();
+        if (not colType.has_value() || not reader.read_val<uint32_t>().has_value()) { return invalid; }
+
+        auto validity = reader.read_array<uint64_t>((rowCount.value() + 63) / 64);
+        if (not validity.has_value()) { return invalid; }
+        Bitmap                            itemFlags = make_itemFlags(std::move(validity.value()), rowCount.value());
+        DataStore::varCol_t               data;
+        std::optional<DataStore::CatDict> catDict = std::nullopt;
+
+        switch (static_cast<parsedVal_t>(colType.value())) {
+            case parsedVal_t::signed_like: {
+                auto values = reader.read_array<long long>(rowCount.value());
+                if (not values.has_value()) { return invalid; }
+                data = std::move(values.value());
+                break;
+            }
+            case parsedVal_t::double_like: {
+                auto values = reader.read_array<double>(rowCount.value());
+                if (not values.has_value()) { return invalid; }
+                data = std::move(values.value());
+                break;
+            }
+            case parsedVal_t::string_like: {
+                auto const dictSize = reader.read_val<uint64_t>();
+                if (not dictSize.has_value() || dictSize.value() > std::numeric_limits<uint32_t>::max()) {
+                    return invalid;
+                }
+                auto const offsets = reader.read_array<uint64_t>(dictSize.value() + 1);
+                auto       codes   = reader.read_array<uint32_t>(rowCount.value());
+                if (not offsets.has_value() || not codes.has_value() || not reader.skip_padding()) { return invalid; }
+                auto const dictBytes = reader.read_bytes(offsets->back());
+                if (not dictBytes.has_value() || offsets->front() != 0 || not std::ranges::is_sorted(offsets.value())) {
+                    return invalid;
+                }
+
+                // Categories are views into the mapped dictionary, rows just point at their category
+                std::vector<std::string_view> categories;
+                categories.reserve(dictSize.value());
+                for (size_t code = 0; code < dictSize.value(); ++code) {
+                    categories.push_back(
+                        dictBytes->substr(offsets->at(code), offsets->at(code + 1) - offsets->at(code)));
+                }
+
+                DataStore::CatDict            colDict;
+                std::vector<std::string_view> rows;
+                rows.reserve(codes->size());
+                for (auto const &category : categories) {
+                    if (not colDict.dict.try_emplace(category, 0uz).second) { return invalid; }
+                }
+                for (auto const code : codes.value()) {
+                    if (code >= categories.size()) { return invalid; }
+                    (colDict.dict.begin() + code)->second++;
+                    rows.push_back(categories[code]);
+                }
+                colDict.codes = std::move(codes.value());
+
+                // Already decoded dictionary is passed in, so that the column doesn't build it again
+                data    = std::move(rows);
+                catDict = std::move(colDict);
+                break;
+            }
+            default: return invalid;
+        }
+        if (not reader.skip_padding()) { return invalid; }
+        res.m_data.push_back(
+            DataStore::Column(std::string(name.value()), std::move(itemFlags), std::move(data), std::move(catDict)));
+    }
+
+    res.m_inputBuffers.push_back(inputBuffer);
+    return res;
+}
+
+} // namespace snapshot
+} // namespace terminal_plot
+} // namespace incom
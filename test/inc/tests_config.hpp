@@ -67,6 +67,21 @@ struct DataSets_FN {
         TEST_DF "/wine_quality/wine_quality_data.json"sv, TEST_DF "/wine_quality/wine_quality_data.ndjson"sv};
 };
 
+// Sets one of the 'Config' settings for the lifetime of the guard only
+// Restores the original value even when the test returns early (on failed ASSERT_*)
+template <typename T>
+class ScopedSetting {
+    T      &m_setting;
+    T const m_original;
+
+public:
+    ScopedSetting(T &setting, T const newValue) : m_setting(setting), m_original(setting) { m_setting = newValue; }
+    ~ScopedSetting() { m_setting = m_original; }
+
+    ScopedSetting(ScopedSetting const &)            = delete;
+    ScopedSetting &operator=(ScopedSetting const &) = delete;
+};
+
 struct DataSets_FN_transposed {
     using svArray = std::array<std::string_view, 4>;
     static constexpr svArray csv{DataSets_FN::flights[0], DataSets_FN::nile[0],
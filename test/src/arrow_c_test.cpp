@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <incstd/incstd_all.hpp>
+#include <limits>
+#include <ranges>
+
+#include <incplot-lib.hpp>
+#include <tests_config.hpp>
+
+
+using namespace incom::terminal_plot::testing;
+namespace incplot = incom::terminal_plot;
+
+TEST(ArrowTest, roundTripsParsedData) {
+    for (auto const &oneFN : DataSets_FN_transposed::csv) {
+        auto dt = incstd::filesys::get_file_textual(oneFN);
+        ASSERT_TRUE(dt.has_value());
+        auto parsedDS = incplot::parsers::Parser::parse(dt.value());
+        ASSERT_TRUE(parsedDS.has_value());
+        size_t const rowCount = parsedDS->get_rowCount();
+        if (rowCount < 2) { continue; }
+
+        ArrowSchema schema;
+        ArrowArray  array;
+        incplot::arrow_c::to_arrow(parsedDS.value(), &schema, &array);
+        ASSERT_EQ(array.n_children, static_cast<int64_t>(parsedDS->m_data.size()));
+
+        // Slicing the exported struct by one row checks that offsets are applied on import
+        array.offset = 1;
+        array.length = static_cast<int64_t>(rowCount - 1);
+        auto importedDS = incplot::arrow_c::from_arrow(&schema, &array);
+        ASSERT_TRUE(importedDS.has_value());
+        EXPECT_EQ(schema.release, nullptr);
+        EXPECT_EQ(array.release, nullptr);
+
+        // Values in null slots are not carried over, so only the valid cells are compared
+        ASSERT_EQ(importedDS->m_data.size(), parsedDS->m_data.size());
+        for (auto const &[col_I, col_P] : std::views::zip(importedDS->m_data, parsedDS->m_data)) {
+            EXPECT_EQ(col_I.name, col_P.name);
+            EXPECT_EQ(col_I.get_colType(), col_P.get_colType());
+            EXPECT_TRUE(std::ranges::equal(col_I.get_itemFlags(), col_P.get_itemFlags() | std::views::drop(1)));
+            for (size_t rowID = 0; rowID < rowCount - 1; ++rowID) {
+                if (col_I.get_itemFlags()[rowID] & 0b1) { continue; }
+                auto visi = [&](auto const &vec_I, auto const &vec_P) {
+                    if constexpr (requires { vec_I.at(rowID) == vec_P.at(rowID); }) {
+                        EXPECT_EQ(vec_I.at(rowID), vec_P.at(rowID + 1));
+                    }
+                    else { ADD_FAILURE(); }
+                };
+                std::visit(visi, col_I.get_variantData(), col_P.get_variantData());
+            }
+        }
+    }
+
+    // Anything but a struct array is rejected (and still released)
+    incplot::DataStore::DS_CtorObj ctorObj{.data      = {{"vals", std::vector<long long>{1, 2, 3}}},
+                                           .itemFlags = {incplot::Bitmap(3)}};
+    ArrowSchema                    schema;
+    ArrowArray                     array;
+    incplot::arrow_c::to_arrow(incplot::DataStore(ctorObj), &schema, &array);
+    schema.format = "+l";
+    EXPECT_FALSE(incplot::arrow_c::from_arrow(&schema, &array).has_value());
+    EXPECT_EQ(schema.release, nullptr);
+    EXPECT_EQ(array.release, nullptr);
+}
+
+TEST(ArrowTest, unsignedAboveLongLong_rejected) {
+    // Exported long long column is imported again as unsigned 64bit ('L'), so -1 is the largest uint64 there is
+    auto import_asUnsigned = [](std::vector<long long> const &vals, incplot::Bitmap const &itemFlags) {
+        incplot::DataStore::DS_CtorObj ctorObj{.data = {{"vals", vals}}, .itemFlags = {itemFlags}};
+        ArrowSchema                    schema;
+        ArrowArray                     array;
+        incplot::arrow_c::to_arrow(incplot::DataStore(ctorObj), &schema, &array);
+        schema.children[0]->format = "L";
+        return incplot::arrow_c::from_arrow(&schema, &array);
+    };
+
+    auto const inRange = import_asUnsigned({1, 2, std::numeric_limits<long long>::max()}, incplot::Bitmap(3));
+    ASSERT_TRUE(inRange.has_value());
+    EXPECT_EQ(inRange->m_data.at(0).get_data<std::vector<long long>>(),
+              (std::vector<long long>{1, 2, std::numeric_limits<long long>::max()}));
+
+    auto const aboveRange = import_asUnsigned({1, -1, 3}, incplot::Bitmap(3));
+    ASSERT_FALSE(aboveRange.has_value());
+    EXPECT_EQ(aboveRange.error(), incerr::incerr_code::make(incplot::Unexp_parser::ARROW_unsupportedFormat));
+
+    // Values in null slots are never imported, so they don't matter
+    auto const inNullSlot = import_asUnsigned({1, -1, 3}, incplot::Bitmap{0, 1, 0});
+    ASSERT_TRUE(inNullSlot.has_value());
+    EXPECT_EQ(inNullSlot->m_data.at(0).get_itemFlags(), (incplot::Bitmap{0, 1, 0}));
+}
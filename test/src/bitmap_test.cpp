@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <incplot-lib.hpp>
+#include <tests_config.hpp>
+
+
+using namespace incom::terminal_plot::testing;
+namespace incplot = incom::terminal_plot;
+
+TEST(BitmapTest, appendAndEraseAcrossWords) {
+    // Flags of every third row, built up a row at a time and then as two unaligned halves
+    size_t const        rowCount = 150;
+    incplot::Bitmap     byRow;
+    std::vector<size_t> expSet;
+    for (size_t rowID = 0; rowID < rowCount; ++rowID) {
+        byRow.push_back(rowID % 3 == 0 ? 0b1 : 0b0);
+        if (rowID % 3 == 0) { expSet.push_back(rowID); }
+    }
+    EXPECT_EQ(byRow.size(), rowCount);
+    EXPECT_EQ(byRow.count(), expSet.size());
+    EXPECT_TRUE(std::ranges::equal(byRow.get_setPositions(), expSet));
+
+    incplot::Bitmap firstPart, secondPart;
+    for (size_t rowID = 0; rowID < 70; ++rowID) { firstPart.push_back(byRow[rowID]); }
+    for (size_t rowID = 70; rowID < rowCount; ++rowID) { secondPart.push_back(byRow[rowID]); }
+    firstPart.append(secondPart);
+    EXPECT_EQ(firstPart, byRow);
+
+    // Dropping an unaligned number of rows from the front moves the rest across the word boundaries
+    byRow.erase_front(65);
+    EXPECT_EQ(byRow.size(), rowCount - 65);
+    std::vector<size_t> expAfterErase;
+    for (auto const rowID : expSet) {
+        if (rowID >= 65) { expAfterErase.push_back(rowID - 65); }
+    }
+    EXPECT_TRUE(std::ranges::equal(byRow.get_setPositions(), expAfterErase));
+    EXPECT_TRUE(std::ranges::equal(byRow.get_selection(), byRow.get_unsetPositions()));
+}
+
+TEST(BitmapTest, filterFlags_spanMultipleWords) {
+    // Enough rows for the flags to take up several 64bit words (with a partially used last one)
+    size_t const           rowCount = 150;
+    std::vector<double>    vals(rowCount, 1.0);
+    std::vector<long long> ints(std::from_range, std::views::iota(0ll, static_cast<long long>(rowCount)));
+    std::vector<size_t>    expNulls;
+    for (size_t rowID = 0; rowID < rowCount; rowID += 7) {
+        vals[rowID] = std::numeric_limits<double>::quiet_NaN();
+        expNulls.push_back(rowID);
+    }
+    vals[100] = 1000.0; // The only extreme value
+    auto ds   = incplot::DataStoreBuilder().add_column("vals", vals).add_column("ints", ints).build();
+    ASSERT_TRUE(ds.has_value());
+
+    auto const flags = ds->compute_filterFlags(std::vector<size_t>{0, 1}, 3.0);
+    EXPECT_TRUE(std::ranges::equal(flags.nulls.get_setPositions(), expNulls));
+    EXPECT_TRUE(std::ranges::equal(flags.outsideStdDev.get_setPositions(), std::vector<size_t>{100}));
+    EXPECT_EQ(flags.get_filteredCount(), expNulls.size() + 1);
+    EXPECT_EQ(flags.get_unfilteredCount(), rowCount - expNulls.size() - 1);
+
+    // Filtered view has exactly the rows that are not flagged, in their original order
+    auto   view     = ds->get_filteredViewOfData(1uz, flags.combined);
+    size_t viewSize = 0;
+    std::visit([&](auto const &vw) { viewSize = std::ranges::distance(vw); }, view);
+    EXPECT_EQ(viewSize, flags.get_unfilteredCount());
+
+    // Selection vector has the same rows, gathered data are exactly the values of those rows
+    auto const selection = flags.combined.get_selection();
+    EXPECT_TRUE(std::ranges::equal(selection, flags.combined.get_unsetPositions()));
+    auto const gathered = ds->get_gatheredData(1uz, selection);
+    ASSERT_TRUE(std::holds_alternative<std::vector<long long>>(gathered));
+    std::vector<long long> expGathered;
+    for (auto const rowID : selection) { expGathered.push_back(ints[rowID]); }
+    EXPECT_EQ(std::get<std::vector<long long>>(gathered), expGathered);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <incstd/incstd_all.hpp>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <incplot-lib.hpp>
+#include <tests_config.hpp>
+
+
+using namespace incom::terminal_plot::testing;
+namespace incplot = incom::terminal_plot;
+
+TEST(DataStoreBuilderTest, matchesParsedData) {
+    std::vector<std::string_view> const labels{"a", "b", "c", "d"};
+    std::vector<long long> const        counts{3, 1, 4, 1};
+    std::vector<double> const           ratios{0.5, 1.5, 2.5, 3.5};
+
+    auto builtDS = incplot::DataStoreBuilder()
+                       .add_column("label", labels)
+                       .add_column("count", counts)
+                       .add_column("ratio", ratios)
+                       .build();
+    ASSERT_TRUE(builtDS.has_value());
+    auto parsedDS = incplot::parsers::Parser::parse("label,count,ratio\na,3,0.5\nb,1,1.5\nc,4,2.5\nd,1,3.5\n");
+    ASSERT_TRUE(parsedDS.has_value());
+
+    ASSERT_EQ(builtDS->m_data.size(), parsedDS->m_data.size());
+    for (auto const &[col_B, col_P] : std::views::zip(builtDS->m_data, parsedDS->m_data)) {
+        EXPECT_EQ(col_B.name, col_P.name);
+        EXPECT_EQ(col_B.get_colType(), col_P.get_colType());
+        EXPECT_EQ(col_B.get_itemFlags(), col_P.get_itemFlags());
+        EXPECT_EQ(col_B.get_catDict().has_value(), col_P.get_catDict().has_value());
+    }
+
+    // Plot of the built DataStore is the same as the plot of the equivalent text
+    incplot::DesiredPlot const dp(incplot::DesiredPlot::DP_CtorStruct{.tar_width = 64, .tar_height = 20});
+    auto const plot_B = incplot::make_plot(dp, builtDS.value());
+    auto const plot_P = incplot::make_plot(dp, "label,count,ratio\na,3,0.5\nb,1,1.5\nc,4,2.5\nd,1,3.5\n"sv);
+    ASSERT_EQ(plot_B.has_value(), plot_P.has_value());
+    if (plot_B.has_value()) { EXPECT_EQ(plot_B.value(), plot_P.value()); }
+
+    // Non-finite values are null, columns of different sizes are an error
+    std::vector<double> const withNaN{1.0, std::numeric_limits<double>::quiet_NaN(), 3.0, 4.0};
+    auto nanDS = incplot::DataStoreBuilder().add_column("label", labels).add_column("vals", withNaN).build();
+    ASSERT_TRUE(nanDS.has_value());
+    EXPECT_EQ(nanDS->m_data.at(1).get_itemFlags(), (incplot::Bitmap{0, 1, 0, 0}));
+    auto const unevenDS =
+        incplot::DataStoreBuilder().add_column("label", labels).add_column("vals", std::span(counts).first(2)).build();
+    ASSERT_FALSE(unevenDS.has_value());
+    EXPECT_EQ(unevenDS.error(), incerr::incerr_code::make(incplot::Unexp_builder::BUILDER_columnSizesDiffer));
+}
@@ -1,13 +1,34 @@
 
 #include <gtest/gtest.h>
 #include <incstd/incstd_all.hpp>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <thread>
 
 #include <incplot-lib.hpp>
+#include <incplot-lib_private/parse_number.hpp>
 #include <tests_config.hpp>
 
 using namespace incom::terminal_plot::testing;
 namespace incplot = incom::terminal_plot;
 
+// DataStore::operator== doesn't compare anything (yet) so the actual data need to be compared 'by hand'
+static bool is_sameData(incplot::DataStore const &ds_A, incplot::DataStore const &ds_B) {
+    if (ds_A.m_data.size() != ds_B.m_data.size()) { return false; }
+    for (auto const &[col_A, col_B] : std::views::zip(ds_A.m_data, ds_B.m_data)) {
+        if (col_A.name != col_B.name || col_A.get_colType() != col_B.get_colType() ||
+            col_A.get_itemFlags() != col_B.get_itemFlags() || col_A.get_variantData() != col_B.get_variantData()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 
 TEST(ParserTest, parsing_csv) {
     auto sourceFileTypeSet{DataSets_FN_transposed::csv};
@@ -66,3 +87,652 @@ TEST(ParserTest, identicalDS_regardlessOfFileType) {
 
     EXPECT_TRUE(dataConsistentInEachSet);
 }
+
+TEST(ParserTest, mappedInput_identicalToTextual) {
+    constexpr std::array allDataSets{DataSets_FN::flights, DataSets_FN::penguins, DataSets_FN::nile,
+                                     DataSets_FN::wine_quality};
+
+    for (auto const &oneSet : allDataSets) {
+        for (auto const &oneFN : oneSet) {
+            auto textual = incstd::filesys::get_file_textual(oneFN);
+            auto mapped  = incplot::InputBuffer::map_file(oneFN);
+            ASSERT_TRUE(textual.has_value());
+            ASSERT_TRUE(mapped.has_value());
+
+            EXPECT_TRUE(mapped->is_mapped());
+            EXPECT_EQ(mapped->get_view(), std::string_view(textual.value()));
+        }
+    }
+}
+
+TEST(ParserTest, streamedDS_identicalToParsed) {
+    ScopedSetting const chunkSize{incplot::Config::parser_streamChunkSize, 256uz};
+
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::tsv, DataSets_FN_transposed::json,
+                               DataSets_FN_transposed::ndjson}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto parsedDS = incplot::parsers::Parser::parse(dt.value());
+            ASSERT_TRUE(parsedDS.has_value());
+
+            std::istringstream iss(dt.value());
+            auto               streamedDS = incplot::parsers::Parser::parse_stream(iss);
+            ASSERT_TRUE(streamedDS.has_value());
+
+            EXPECT_TRUE(is_sameData(parsedDS.value(), streamedDS.value()));
+        }
+    }
+}
+
+TEST(ParserTest, streamedCSV_quotedFieldsSpanningParts) {
+    ScopedSetting const chunkSize{incplot::Config::parser_streamChunkSize, 16uz};
+
+    // Quoted fields contain newlines (which don't end the row) as well as delimiters
+    std::string csv = "name,val\n";
+    for (size_t i = 0; i < 20; ++i) { csv.append(std::format("\"row\n{},x\",{}\n", i, i)); }
+
+    auto parsedDS = incplot::parsers::Parser::parse(csv);
+    ASSERT_TRUE(parsedDS.has_value());
+    EXPECT_EQ(parsedDS->get_rowCount(), 20);
+
+    std::istringstream iss(csv);
+    auto               streamedDS = incplot::parsers::Parser::parse_stream(iss);
+    ASSERT_TRUE(streamedDS.has_value());
+    EXPECT_TRUE(is_sameData(parsedDS.value(), streamedDS.value()));
+
+    // Rows of later parts are validated against the header of the first one
+    std::istringstream badIss("a,b\n1,2\n3,4\n5,6\n7,8\n9,10,11\n");
+    auto               badDS = incplot::parsers::Parser::parse_stream(badIss);
+    ASSERT_FALSE(badDS.has_value());
+    EXPECT_EQ(badDS.error(), incerr::incerr_code::make(incplot::Unexp_parser::CSV_headerHasLessItemsThanDataRow));
+}
+
+// Compressed fixtures are the very same data as their plain counterparts
+static void expect_compressedSameAsPlain(std::string_view const compressedFN, std::string_view const plainFN) {
+    ScopedSetting const chunkSize{incplot::Config::parser_streamChunkSize, 64uz};
+
+    auto dt = incstd::filesys::get_file_textual(plainFN);
+    ASSERT_TRUE(dt.has_value());
+    auto parsedDS = incplot::parsers::Parser::parse(dt.value());
+    ASSERT_TRUE(parsedDS.has_value());
+
+    std::ifstream ifs{std::string(compressedFN), std::ios::binary};
+    ASSERT_TRUE(ifs.is_open());
+    auto streamedDS = incplot::parsers::Parser::parse_stream(ifs);
+    ASSERT_TRUE(streamedDS.has_value());
+    EXPECT_TRUE(is_sameData(parsedDS.value(), streamedDS.value()));
+
+    // Files are decompressed the same way when loaded by path
+    auto const loadedDS = incplot::DataStore::get_DS(compressedFN);
+    ASSERT_TRUE(loadedDS.has_value());
+    EXPECT_TRUE(is_sameData(parsedDS.value(), loadedDS->get()));
+}
+
+// Compressed input that is cut short or damaged must be reported rather than parsed as if it was complete
+static void expect_corruptedInputReported(std::string const &corrupted) {
+    ScopedSetting const chunkSize{incplot::Config::parser_streamChunkSize, 64uz};
+
+    std::istringstream iss(corrupted);
+    auto const         streamedDS = incplot::parsers::Parser::parse_stream(iss);
+    ASSERT_FALSE(streamedDS.has_value());
+    EXPECT_EQ(streamedDS.error(), incerr::incerr_code::make(incplot::Unexp_parser::DECOMPRESS_corruptedInput));
+}
+
+static std::string get_fileBinary(std::string_view const fileName) {
+    std::ifstream ifs{std::string(fileName), std::ios::binary};
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+TEST(ParserTest, compressedStream_gzip_identicalToParsed) {
+#ifndef INCPLOT_LIB_HAS_ZLIB
+    GTEST_SKIP() << "Built without zlib";
+#endif
+    expect_compressedSameAsPlain(TEST_DF "/nile/nile_data.csv.gz"sv, TEST_DF "/nile/nile_data.csv"sv);
+}
+
+TEST(ParserTest, compressedStream_zstd_identicalToParsed) {
+#ifndef INCPLOT_LIB_HAS_ZSTD
+    GTEST_SKIP() << "Built without libzstd";
+#endif
+    expect_compressedSameAsPlain(TEST_DF "/nile/nile_data.ndjson.zst"sv, TEST_DF "/nile/nile_data.ndjson"sv);
+}
+
+TEST(ParserTest, DECOMPRESS_corruptedInput) {
+#ifndef INCPLOT_LIB_HAS_ZLIB
+    GTEST_SKIP() << "Built without zlib";
+#endif
+    std::string const gzipped = get_fileBinary(TEST_DF "/nile/nile_data.csv.gz"sv);
+    ASSERT_GT(gzipped.size(), 16);
+    expect_corruptedInputReported(gzipped.substr(0, gzipped.size() / 2));
+
+    // Last 8 bytes are the CRC32 and size of the data, so everything gets decompressed before the mismatch is found
+    std::string badChecksum = gzipped;
+    badChecksum[badChecksum.size() - 8] ^= 0xff;
+    expect_corruptedInputReported(badChecksum);
+}
+
+TEST(ParserTest, DECOMPRESS_truncatedZstdInput) {
+#ifndef INCPLOT_LIB_HAS_ZSTD
+    GTEST_SKIP() << "Built without libzstd";
+#endif
+    std::string const zstded = get_fileBinary(TEST_DF "/nile/nile_data.ndjson.zst"sv);
+    ASSERT_GT(zstded.size(), 16);
+    expect_corruptedInputReported(zstded.substr(0, zstded.size() / 2));
+}
+
+TEST(ParserTest, csvColumnsPromotedBeyondTypeSample) {
+    ScopedSetting const sampleRows{incplot::Config::parser_typeSampleRows, 1uz};
+    auto parsed = incplot::parsers::Parser::parse("name,late,val,mixed\nx,,1,1\ny,3,2.5,2\nz,4,3,abc");
+
+    ASSERT_TRUE(parsed.has_value());
+    auto const &cols = parsed.value().m_data;
+    ASSERT_EQ(cols.size(), 4);
+
+    EXPECT_EQ(cols.at(1).get_colType(), incplot::parsedVal_t::signed_like);
+    EXPECT_EQ(cols.at(1).get_data<std::vector<long long>>(), (std::vector<long long>{0, 3, 4}));
+    EXPECT_EQ(cols.at(1).get_itemFlags(), (incplot::Bitmap{0b1, 0b0, 0b0}));
+
+    EXPECT_EQ(cols.at(2).get_colType(), incplot::parsedVal_t::double_like);
+    EXPECT_EQ(cols.at(2).get_data<std::vector<double>>(), (std::vector<double>{1.0, 2.5, 3.0}));
+
+    EXPECT_EQ(cols.at(3).get_colType(), incplot::parsedVal_t::string_like);
+    EXPECT_EQ(cols.at(3).get_data<std::vector<std::string>>(), (std::vector<std::string>{"1", "2", "abc"}));
+}
+
+TEST(ParserTest, csvColumnsPromotedIntoStrings_keepSourceText) {
+    ScopedSetting const sampleRows{incplot::Config::parser_typeSampleRows, 1uz};
+    std::string const   csv = "code,val\n007,1.50\n1.50,2\n,2.0\nabc,x\n";
+
+    auto parsed = incplot::parsers::Parser::parse(csv);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->m_data.at(0).get_data<std::vector<std::string>>(),
+              (std::vector<std::string>{"007", "1.50", "", "abc"}));
+    EXPECT_EQ(parsed->m_data.at(0).get_itemFlags(), (incplot::Bitmap{0b0, 0b0, 0b1, 0b0}));
+    EXPECT_EQ(parsed->m_data.at(1).get_data<std::vector<std::string>>(),
+              (std::vector<std::string>{"1.50", "2", "2.0", "x"}));
+
+    // Lazily converted columns are always converted from the text of the cells
+    auto lazy = incplot::parsers::Parser::parse(std::make_shared<incplot::InputBuffer const>(std::string(csv)),
+                                                {.lazyColumns = true});
+    ASSERT_TRUE(lazy.has_value());
+    for (auto const &[col_eager, col_lazy] : std::views::zip(parsed->m_data, lazy->m_data)) {
+        auto materialized = col_lazy.get_variantData();
+        incplot::DataStore::materialize_strViews(materialized);
+        EXPECT_EQ(col_eager.get_variantData(), materialized);
+    }
+}
+
+TEST(ParserTest, parallelDS_identicalToSingleThreaded) {
+    ScopedSetting const minChunk{incplot::Config::parser_parallelMinChunkSize, 256uz};
+
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::tsv, DataSets_FN_transposed::ndjson}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto singleDS = [&] {
+                ScopedSetting const threadCount{incplot::Config::parser_threadCount, 1uz};
+                return incplot::parsers::Parser::parse(dt.value());
+            }();
+            auto parallelDS = [&] {
+                ScopedSetting const threadCount{incplot::Config::parser_threadCount, 4uz};
+                return incplot::parsers::Parser::parse(dt.value());
+            }();
+
+            ASSERT_TRUE(singleDS.has_value());
+            ASSERT_TRUE(parallelDS.has_value());
+            EXPECT_TRUE(is_sameData(singleDS.value(), parallelDS.value()));
+        }
+    }
+}
+
+TEST(ParserTest, parallelDS_sharesInferredTypes) {
+    ScopedSetting const minChunk{incplot::Config::parser_parallelMinChunkSize, 256uz};
+
+    // Only the very first row tells that 'code' is a string column, the rest of its cells look like numbers
+    std::string csv = "code,val\n";
+    for (size_t i = 0; i < 200; ++i) {
+        csv.append(std::format("{},{}\n", i == 0 ? std::string("x") : std::format("{:03}.50", i), i));
+    }
+
+    auto singleDS = [&] {
+        ScopedSetting const threadCount{incplot::Config::parser_threadCount, 1uz};
+        return incplot::parsers::Parser::parse(csv);
+    }();
+    auto parallelDS = [&] {
+        ScopedSetting const threadCount{incplot::Config::parser_threadCount, 4uz};
+        return incplot::parsers::Parser::parse(csv);
+    }();
+    ASSERT_TRUE(singleDS.has_value());
+    ASSERT_TRUE(parallelDS.has_value());
+    EXPECT_TRUE(is_sameData(singleDS.value(), parallelDS.value()));
+
+    auto const &codes = parallelDS->m_data.at(0).get_data<std::vector<std::string>>();
+    ASSERT_EQ(codes.size(), 200);
+    EXPECT_EQ(codes.at(1), "001.50");
+    EXPECT_EQ(codes.at(199), "199.50");
+}
+
+TEST(ParserTest, sampledInputType_identicalToWhole) {
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::tsv, DataSets_FN_transposed::json,
+                               DataSets_FN_transposed::ndjson}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto wholeDS   = incplot::parsers::Parser::parse(dt.value());
+            auto sampledDS = [&] {
+                ScopedSetting const sampleSize{incplot::Config::parser_detectSampleSize, 256uz};
+                return incplot::parsers::Parser::parse(dt.value());
+            }();
+
+            ASSERT_TRUE(wholeDS.has_value());
+            ASSERT_TRUE(sampledDS.has_value());
+            EXPECT_TRUE(is_sameData(wholeDS.value(), sampledDS.value()));
+        }
+    }
+}
+
+TEST(ParserTest, localeFreeDouble_sameAsFromChars) {
+    using incom::terminal_plot::detail::parse_number::parse_doubleLocaleFree;
+    auto parsed = [](std::string_view const sv) -> std::optional<double> {
+        double res = 0.0;
+        return parse_doubleLocaleFree(sv, res) ? std::optional(res) : std::nullopt;
+    };
+
+    EXPECT_EQ(parsed("1.5"), 1.5);
+    EXPECT_EQ(parsed("-0.25"), -0.25);
+    EXPECT_EQ(parsed("007"), 7.0);
+    EXPECT_EQ(parsed("1e3"), 1000.0);
+    EXPECT_EQ(parsed("2.5E-2"), 0.025);
+    EXPECT_EQ(parsed("123456789012345678901234567890"), 123456789012345678901234567890.0);
+    EXPECT_EQ(parsed("1.7976931348623157e308"), std::numeric_limits<double>::max());
+    EXPECT_EQ(parsed("4.9406564584124654e-324"), std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(parsed("0e-400"), 0.0);
+
+    EXPECT_EQ(parsed("inf"), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(parsed("-Infinity"), -std::numeric_limits<double>::infinity());
+    for (auto const nan : {"nan"sv, "NaN"sv, "-nan"sv, "nan(123_ab)"sv}) {
+        ASSERT_TRUE(parsed(nan).has_value());
+        EXPECT_TRUE(std::isnan(parsed(nan).value()));
+    }
+
+    // Rejected by std::from_chars (in its 'general' format) just the same
+    for (auto const bad : {""sv, "-"sv, "."sv, "+1"sv, " 1"sv, "1 "sv, "1e"sv, "1e+"sv, "0x10"sv, "1.5x"sv, "in"sv,
+                           "infinit"sv, "nan("sv, "nan(1-2)"sv, "1e400"sv, "36e-381"sv, "-2e-5178800"sv}) {
+        EXPECT_FALSE(parsed(bad).has_value()) << bad;
+    }
+}
+
+TEST(ParserTest, nestedJSON_flattenedIntoColumns) {
+    auto parsed = incplot::parsers::Parser::parse(
+        R"([{"a": 1, "pos": {"x": 1.5, "y": "s"}},
+{"a": 2, "pos": {"x": 2.5, "y": "t"}},
+{"a": 3, "pos": {"y": "u", "x": 3.5}}])");
+
+    ASSERT_TRUE(parsed.has_value());
+    auto const &cols = parsed.value().m_data;
+    ASSERT_EQ(cols.size(), 3);
+
+    EXPECT_EQ(cols.at(1).name, "pos/x");
+    EXPECT_EQ(cols.at(1).get_data<std::vector<double>>(), (std::vector<double>{1.5, 2.5, 3.5}));
+    EXPECT_EQ(cols.at(2).name, "pos/y");
+    EXPECT_EQ(cols.at(2).get_data<std::vector<std::string>>(), (std::vector<std::string>{"s", "t", "u"}));
+}
+
+TEST(ParserTest, columnarJSON_identicalToRecords) {
+    auto columnar = incplot::parsers::Parser::parse(R"({"name": ["a", "b", "c"], "val": [1, 2.5, 3], "cnt": [1, 2, 3]})");
+    auto records  = incplot::parsers::Parser::parse(R"([{"name": "a", "val": 1.0, "cnt": 1},
+{"name": "b", "val": 2.5, "cnt": 2},
+{"name": "c", "val": 3.0, "cnt": 3}])");
+
+    ASSERT_TRUE(columnar.has_value());
+    ASSERT_TRUE(records.has_value());
+    EXPECT_TRUE(is_sameData(columnar.value(), records.value()));
+}
+
+TEST(ParserTest, ndjsonWithArray_notMistakenForColumnar) {
+    auto parsed = incplot::parsers::Parser::parse("{\"a\": [1, 2], \"b\": 1}\n{\"a\": [3, 4], \"b\": 2}");
+    ASSERT_FALSE(parsed.has_value());
+    EXPECT_EQ(parsed.error(), incerr::incerr_code::make(incplot::Unexp_parser::NDJSON_isNotFlat));
+}
+
+TEST(ParserTest, stringColumns_dictionaryEncoded) {
+    ScopedSetting const sampleRows{incplot::Config::parser_typeSampleRows, 1uz};
+    auto parsed = incplot::parsers::Parser::parse("name,val,mixed\nb,1,1\na,2,2\nb,3,abc\nc,4,2");
+
+    ASSERT_TRUE(parsed.has_value());
+    auto const &cols = parsed.value().m_data;
+    ASSERT_EQ(cols.size(), 3);
+    EXPECT_FALSE(cols.at(1).get_catDict().has_value());
+
+    ASSERT_TRUE(cols.at(0).get_catDict().has_value());
+    auto const &nameDict = cols.at(0).get_catDict().value();
+    EXPECT_EQ(nameDict.codes, (std::vector<uint32_t>{0, 1, 0, 2}));
+    EXPECT_EQ(nameDict.get_categoryCount(), 3);
+    EXPECT_EQ(nameDict.get_category(1), "a");
+    EXPECT_EQ(nameDict.get_count(0), 2);
+    EXPECT_EQ(nameDict.get_sortedCategories(), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(nameDict.get_sortedIDs(), (std::vector<size_t>{1, 0, 1, 2}));
+
+    auto const filtered = nameDict.get_filtered({0b0, 0b1, 0b0, 0b0});
+    EXPECT_EQ(filtered.get_sortedCategories(), (std::vector<std::string>{"b", "c"}));
+    EXPECT_EQ(filtered.get_sortedIDs(), (std::vector<size_t>{0, 0, 1}));
+
+    // Column promoted to strings after the type sample gets its dictionary too
+    ASSERT_TRUE(cols.at(2).get_catDict().has_value());
+    EXPECT_EQ(cols.at(2).get_catDict()->codes, (std::vector<uint32_t>{0, 1, 2, 1}));
+}
+
+TEST(ParserTest, zeroCopyStrings_identicalToOwned) {
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::tsv}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto ownedDS = incplot::parsers::Parser::parse(dt.value());
+            // The only owner of the input is the DataStore parsed from it
+            auto viewDS  = incplot::parsers::Parser::parse(
+                std::make_shared<incplot::InputBuffer const>(std::move(dt.value())));
+            ASSERT_TRUE(ownedDS.has_value());
+            ASSERT_TRUE(viewDS.has_value());
+            EXPECT_EQ(viewDS->m_inputBuffers.size(), 1);
+
+            ASSERT_EQ(ownedDS->m_data.size(), viewDS->m_data.size());
+            for (auto const &[col_owned, col_view] : std::views::zip(ownedDS->m_data, viewDS->m_data)) {
+                EXPECT_EQ(col_owned.get_colType(), col_view.get_colType());
+                EXPECT_EQ(col_owned.get_itemFlags(), col_view.get_itemFlags());
+
+                auto materialized = col_view.get_variantData();
+                incplot::DataStore::materialize_strViews(materialized);
+                EXPECT_EQ(col_owned.get_variantData(), materialized);
+            }
+        }
+    }
+}
+
+TEST(ParserTest, lazyColumns_identicalToEager) {
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::tsv}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto eagerDS = incplot::parsers::Parser::parse(dt.value());
+            // Fields indexed in multiple chunks must end up the same as if indexed in one go
+            auto lazyDS  = [&] {
+                ScopedSetting const threadCount{incplot::Config::parser_threadCount, 4uz};
+                ScopedSetting const minChunk{incplot::Config::parser_parallelMinChunkSize, 256uz};
+                return incplot::parsers::Parser::parse(
+                    std::make_shared<incplot::InputBuffer const>(std::move(dt.value())), {.lazyColumns = true});
+            }();
+            ASSERT_TRUE(eagerDS.has_value());
+            ASSERT_TRUE(lazyDS.has_value());
+            EXPECT_EQ(eagerDS->get_rowCount(), lazyDS->get_rowCount());
+
+            ASSERT_EQ(eagerDS->m_data.size(), lazyDS->m_data.size());
+            for (auto const &[col_eager, col_lazy] : std::views::zip(eagerDS->m_data, lazyDS->m_data)) {
+                EXPECT_EQ(col_eager.get_colType(), col_lazy.get_colType());
+                EXPECT_EQ(col_eager.get_itemFlags(), col_lazy.get_itemFlags());
+
+                auto materialized = col_lazy.get_variantData();
+                incplot::DataStore::materialize_strViews(materialized);
+                EXPECT_EQ(col_eager.get_variantData(), materialized);
+            }
+        }
+    }
+}
+
+TEST(ParserTest, lazyColumns_convertedOnFirstAccess) {
+    auto const input  = std::make_shared<incplot::InputBuffer const>(std::string("a,b,c\n1,x,0.5\n2,,1.5\n3,z,2\n"));
+    auto       parsed = incplot::parsers::Parser::parse(input, {.lazyColumns = true});
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(parsed->m_data.size(), 3);
+    EXPECT_EQ(parsed->get_rowCount(), 3);
+    for (auto const &col : parsed->m_data) { EXPECT_FALSE(col.is_materialized()); }
+
+    EXPECT_EQ(parsed->m_data.at(2).get_data<std::vector<double>>(), (std::vector<double>{0.5, 1.5, 2.0}));
+    EXPECT_FALSE(parsed->m_data.at(0).is_materialized());
+    EXPECT_FALSE(parsed->m_data.at(1).is_materialized());
+    EXPECT_TRUE(parsed->m_data.at(2).is_materialized());
+
+    auto const &strCol = parsed->m_data.at(1);
+    EXPECT_EQ(strCol.get_colType(), incplot::parsedVal_t::string_like);
+    EXPECT_EQ(strCol.get_itemFlags(), (incplot::Bitmap{0b0, 0b1, 0b0}));
+    ASSERT_TRUE(strCol.get_catDict().has_value());
+    EXPECT_EQ(strCol.get_catDict()->codes.size(), 3);
+}
+
+TEST(ParserTest, lazyColumns_convertedOnceFromConcurrentReaders) {
+    std::string csv = "idx,val,label\n";
+    for (long long i = 0; i < 1000; ++i) { csv.append(std::format("{},{}.5,lbl{}\n", i, i, i % 7)); }
+    auto const input = std::make_shared<incplot::InputBuffer const>(std::move(csv));
+
+    auto const eager = incplot::parsers::Parser::parse(input, {});
+    auto const lazy  = incplot::parsers::Parser::parse(input, {.lazyColumns = true});
+    ASSERT_TRUE(eager.has_value() && lazy.has_value());
+
+    // Readers only ever get a const DataStore, any of them may be the one that converts a column
+    incplot::DataStore const &shared = lazy.value();
+    std::vector<std::thread>  readers;
+    std::vector<char>         sameAsEager(8, 0);
+    for (size_t readerID = 0; readerID < sameAsEager.size(); ++readerID) {
+        readers.emplace_back([&, readerID]() { sameAsEager[readerID] = is_sameData(shared, eager.value()); });
+    }
+    for (auto &reader : readers) { reader.join(); }
+    EXPECT_TRUE(std::ranges::all_of(sameAsEager, [](char const same) { return same != 0; }));
+
+    // Copy of a column that is not converted yet is converted (and so the same as the eager one) too
+    auto const lazyAgain = incplot::parsers::Parser::parse(input, {.lazyColumns = true});
+    ASSERT_TRUE(lazyAgain.has_value());
+    incplot::DataStore const copied = lazyAgain.value();
+    EXPECT_TRUE(is_sameData(copied, eager.value()));
+}
+
+TEST(ParserTest, rowBudget_keepsEveryNthRow) {
+    std::string csv = "idx,val\n", ndjson, json = "[";
+    for (long long i = 0; i < 10; ++i) {
+        csv.append(std::format("{},{}\n", i, i * 2));
+        ndjson.append(std::format("{{\"idx\": {}, \"val\": {}}}\n", i, i * 2));
+        json.append(std::format("{}{{\"idx\": {}, \"val\": {}}}", i == 0 ? "" : ",", i, i * 2));
+    }
+    json.push_back(']');
+
+    for (auto const &input : {csv, ndjson, json}) {
+        auto parsed = incplot::parsers::Parser::parse(input, {.rowBudget = 3});
+        ASSERT_TRUE(parsed.has_value());
+        EXPECT_EQ(parsed->m_data.at(0).get_data<std::vector<long long>>(), (std::vector<long long>{0, 4, 8}));
+        EXPECT_EQ(parsed->m_data.at(1).get_itemFlags().size(), 3);
+        EXPECT_EQ(parsed->m_sourceRowCount, 10);
+
+        auto whole = incplot::parsers::Parser::parse(input, {.rowBudget = 10});
+        ASSERT_TRUE(whole.has_value());
+        EXPECT_EQ(whole->get_rowCount(), 10);
+        EXPECT_FALSE(whole->m_sourceRowCount.has_value());
+    }
+}
+
+TEST(ParserTest, rowBudget_parallelIdenticalToSingleThreaded) {
+    ScopedSetting const minChunk{incplot::Config::parser_parallelMinChunkSize, 256uz};
+
+    for (auto const &oneSet : {DataSets_FN_transposed::csv, DataSets_FN_transposed::ndjson}) {
+        for (auto const &oneFN : oneSet) {
+            auto dt = incstd::filesys::get_file_textual(oneFN);
+            ASSERT_TRUE(dt.has_value());
+
+            auto singleDS = [&] {
+                ScopedSetting const threadCount{incplot::Config::parser_threadCount, 1uz};
+                return incplot::parsers::Parser::parse(dt.value(), {.rowBudget = 7});
+            }();
+            auto parallelDS = [&] {
+                ScopedSetting const threadCount{incplot::Config::parser_threadCount, 4uz};
+                return incplot::parsers::Parser::parse(dt.value(), {.rowBudget = 7});
+            }();
+
+            ASSERT_TRUE(singleDS.has_value());
+            ASSERT_TRUE(parallelDS.has_value());
+            EXPECT_LE(singleDS->get_rowCount(), 7);
+            EXPECT_EQ(singleDS->m_sourceRowCount, parallelDS->m_sourceRowCount);
+            EXPECT_TRUE(is_sameData(singleDS.value(), parallelDS.value()));
+        }
+    }
+}
+
+TEST(ParserTest, projection_skipsUnreferencedColumns) {
+    std::string const csv      = "a,b,c\n1,x,0.5\n2,y,1.5\n3,z,2.5\n";
+    std::string const ndjson   = "{\"a\": 1, \"b\": \"x\", \"c\": 0.5}\n{\"a\": 2, \"b\": \"y\", \"c\": 1.5}\n"
+                                 "{\"a\": 3, \"b\": \"z\", \"c\": 2.5}\n";
+    std::string const json     = "[{\"a\": 1, \"b\": \"x\", \"c\": 0.5}, {\"a\": 2, \"b\": \"y\", \"c\": 1.5}, "
+                                 "{\"a\": 3, \"b\": \"z\", \"c\": 2.5}]";
+    std::string const columnar = "{\"a\": [1, 2, 3], \"b\": [\"x\", \"y\", \"z\"], \"c\": [0.5, 1.5, 2.5]}";
+
+    for (auto const &input : {csv, ndjson, json, columnar}) {
+        // Columns keep the order of the input, not of the projection
+        auto parsed = incplot::parsers::Parser::parse(input, {.projection = std::vector<std::string>{"c", "a"}});
+        ASSERT_TRUE(parsed.has_value());
+        ASSERT_EQ(parsed->m_data.size(), 2);
+        EXPECT_EQ(parsed->m_data.at(0).name, "a");
+        EXPECT_EQ(parsed->m_data.at(0).get_data<std::vector<long long>>(), (std::vector<long long>{1, 2, 3}));
+        EXPECT_EQ(parsed->m_data.at(1).name, "c");
+        EXPECT_EQ(parsed->m_data.at(1).get_data<std::vector<double>>(), (std::vector<double>{0.5, 1.5, 2.5}));
+    }
+
+    // Rows are still validated in full
+    EXPECT_FALSE(incplot::parsers::Parser::parse(std::string_view("a,b,c\n1,x,0.5\n2,y\n3,z,2.5\n"),
+                                                 {.projection = std::vector<std::string>{"a"}})
+                     .has_value());
+    EXPECT_FALSE(incplot::parsers::Parser::parse(std::string_view("{\"a\": 1, \"b\": \"x\"}\n{\"a\": 2, \"d\": \"y\"}\n"),
+                                                 {.projection = std::vector<std::string>{"a"}})
+                     .has_value());
+}
+
+TEST(ParserTest, schemaHints_bypassInference) {
+    std::string const csv      = "a,b,c\n1,x,0.5\n2,y,1.5\n3,z,2.5\n";
+    std::string const ndjson   = "{\"a\": 1, \"b\": \"x\", \"c\": 0.5}\n{\"a\": 2, \"b\": \"y\", \"c\": 1.5}\n"
+                                 "{\"a\": 3, \"b\": \"z\", \"c\": 2.5}\n";
+    std::string const json     = "[{\"a\": 1, \"b\": \"x\", \"c\": 0.5}, {\"a\": 2, \"b\": \"y\", \"c\": 1.5}, "
+                                 "{\"a\": 3, \"b\": \"z\", \"c\": 2.5}]";
+    std::string const columnar = "{\"a\": [1, 2, 3], \"b\": [\"x\", \"y\", \"z\"], \"c\": [0.5, 1.5, 2.5]}";
+
+    using incplot::parsers::ColumnHint;
+    for (auto const &input : {csv, ndjson, json, columnar}) {
+        // Integer values are stored as hinted, skipped column isn't stored at all, column not hinted is inferred
+        auto parsed = incplot::parsers::Parser::parse(
+            input, {.schemaHints = {{"a", ColumnHint::double_like}, {"b", ColumnHint::skip}}});
+        ASSERT_TRUE(parsed.has_value());
+        ASSERT_EQ(parsed->m_data.size(), 2);
+        EXPECT_EQ(parsed->m_data.at(0).name, "a");
+        EXPECT_EQ(parsed->m_data.at(0).get_data<std::vector<double>>(), (std::vector<double>{1.0, 2.0, 3.0}));
+        EXPECT_EQ(parsed->m_data.at(1).name, "c");
+        EXPECT_EQ(parsed->m_data.at(1).get_data<std::vector<double>>(), (std::vector<double>{0.5, 1.5, 2.5}));
+
+        // Values which don't convert into the hinted type are an error (instead of promoting the column)
+        EXPECT_FALSE(incplot::parsers::Parser::parse(input, {.schemaHints = {{"b", ColumnHint::ll_like}}}).has_value());
+
+        // Numbers which aren't exactly integers are an error too (instead of being truncated)
+        auto const truncated = incplot::parsers::Parser::parse(input, {.schemaHints = {{"c", ColumnHint::ll_like}}});
+        ASSERT_FALSE(truncated.has_value());
+        auto const expErr = input == csv ? incplot::Unexp_parser::CSV_valueTypeDoesntMatch
+                                         : incplot::Unexp_parser::JSON_valueTypeDoesntMatch;
+        EXPECT_EQ(truncated.error(), incerr::incerr_code::make(expErr));
+    }
+
+    // JSON object of plain values (one column) is hinted the same way
+    auto const oneCol =
+        incplot::parsers::Parser::parse_JSON(R"({"v": 2})", {.schemaHints = {{"v", ColumnHint::double_like}}});
+    ASSERT_TRUE(oneCol.has_value());
+    ASSERT_EQ(oneCol->data.size(), 1);
+    EXPECT_EQ(std::get<std::vector<double>>(oneCol->data.at(0).second), (std::vector<double>{2.0}));
+    auto const oneColTruncated =
+        incplot::parsers::Parser::parse_JSON(R"({"v": 2.5})", {.schemaHints = {{"v", ColumnHint::ll_like}}});
+    ASSERT_FALSE(oneColTruncated.has_value());
+    EXPECT_EQ(oneColTruncated.error(), incerr::incerr_code::make(incplot::Unexp_parser::JSON_valueTypeDoesntMatch));
+
+    // CSV column hinted as string keeps numeric cells as they are in the input
+    auto parsed = incplot::parsers::Parser::parse(csv, {.schemaHints = {{"c", ColumnHint::string_like}}});
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->m_data.at(2).get_data<std::vector<std::string>>(),
+              (std::vector<std::string>{"0.5", "1.5", "2.5"}));
+}
+
+TEST(ParserTest, follower_appendsOnlyNewRows) {
+    auto const path = std::filesystem::temp_directory_path() / "incplot_follower_test.csv";
+    auto       write_toFile = [&](std::string_view const text, std::ios::openmode const mode) {
+        std::ofstream(path, std::ios::binary | mode) << text;
+    };
+
+    write_toFile("idx,val\n0,zero\n1,one\n2,tw", std::ios::trunc);
+    incplot::parsers::Follower follower(path.string());
+    auto                       firstPoll = follower.poll();
+    ASSERT_TRUE(firstPoll.has_value());
+    EXPECT_EQ(firstPoll.value(), 2);
+    EXPECT_EQ(follower.get_consumedBytes(), std::string_view("idx,val\n0,zero\n1,one\n").size());
+
+    // The incomplete line is parsed once it gets finished
+    write_toFile("o\n3,three\n", std::ios::app);
+    auto secondPoll = follower.poll();
+    ASSERT_TRUE(secondPoll.has_value());
+    EXPECT_EQ(secondPoll.value(), 2);
+    EXPECT_EQ(follower.poll().value_or(99), 0);
+
+    auto whole = incplot::parsers::Parser::parse(std::string_view("idx,val\n0,zero\n1,one\n2,two\n3,three\n"));
+    ASSERT_TRUE(whole.has_value());
+    ASSERT_TRUE(follower.get_DS().has_value());
+    EXPECT_TRUE(is_sameData(follower.get_DS().value(), whole.value()));
+
+    // Truncated file is followed again from the start
+    write_toFile("idx,val\n5,five\n6,six\n", std::ios::trunc);
+    auto afterTruncation = follower.poll();
+    ASSERT_TRUE(afterTruncation.has_value());
+    EXPECT_EQ(follower.get_DS()->get_rowCount(), 2);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ParserTest, follower_skipsRejectedRows) {
+    auto const path = std::filesystem::temp_directory_path() / "incplot_follower_rejected_test.csv";
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "idx,val\n0,zero\n1,one\n";
+    incplot::parsers::Follower follower(path.string());
+    ASSERT_EQ(follower.poll().value_or(0), 2);
+
+    // Row with an extra field is reported once, the rows appended after it are parsed as usual
+    std::ofstream(path, std::ios::binary | std::ios::app) << "2,two,extra\n";
+    EXPECT_FALSE(follower.poll().has_value());
+    EXPECT_EQ(follower.poll().value_or(99), 0);
+
+    std::ofstream(path, std::ios::binary | std::ios::app) << "3,three\n";
+    EXPECT_EQ(follower.poll().value_or(0), 1);
+
+    auto whole = incplot::parsers::Parser::parse(std::string_view("idx,val\n0,zero\n1,one\n3,three\n"));
+    ASSERT_TRUE(whole.has_value());
+    ASSERT_TRUE(follower.get_DS().has_value());
+    EXPECT_TRUE(is_sameData(follower.get_DS().value(), whole.value()));
+
+    std::filesystem::remove(path);
+}
+
+TEST(ParserTest, follower_restartsOnRotatedFile) {
+    auto const path    = std::filesystem::temp_directory_path() / "incplot_follower_rotation_test.csv";
+    auto const rotated = std::filesystem::path(path).replace_extension(".csv.1");
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "idx,val\n0,zero\n1,one\n";
+    incplot::parsers::Follower follower(path.string());
+    ASSERT_EQ(follower.poll().value_or(0), 2);
+
+    // New file at the same path is larger than what was consumed so far, it is told apart only by being another file
+    std::filesystem::rename(path, rotated);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "idx,val\n5,five\n6,six\n7,seven\n8,eight\n";
+    auto afterRotation = follower.poll();
+    ASSERT_TRUE(afterRotation.has_value());
+    EXPECT_EQ(afterRotation.value(), 4);
+
+    auto whole = incplot::parsers::Parser::parse(std::string_view("idx,val\n5,five\n6,six\n7,seven\n8,eight\n"));
+    ASSERT_TRUE(whole.has_value());
+    ASSERT_TRUE(follower.get_DS().has_value());
+    EXPECT_TRUE(is_sameData(follower.get_DS().value(), whole.value()));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(rotated);
+}
@@ -1,8 +1,43 @@
-
 #include <gtest/gtest.h>
 #include <incstd/incstd_all.hpp>
+#include <algorithm>
+#include <string_view>
+#include <typeindex>
+#include <variant>
 
 #include <incplot-lib.hpp>
 #include <tests_config.hpp>
 
-using namespace incom::terminal_plot::testing;
\ No newline at end of file
+using namespace incom::terminal_plot::testing;
+namespace incplot = incom::terminal_plot;
+
+TEST(ScatterTest, catDict_legendOfUnfilteredRowsOnly) {
+    // Every 'Chinstrap' row has a null value, so that category gets filtered out of the plot entirely
+    auto ds = incplot::parsers::Parser::parse("species,x,y\n"
+                                              "Adelie,1,1.5\nGentoo,2,2.5\nChinstrap,3,\nAdelie,4,3.5\n"
+                                              "Gentoo,5,4.5\nChinstrap,6,\nAdelie,7,5.5\nGentoo,8,6.5\n"
+                                              "Chinstrap,9,\nAdelie,10,7.5\nGentoo,11,8.5\nChinstrap,12,\n"sv);
+    ASSERT_TRUE(ds.has_value());
+    ASSERT_TRUE(ds->m_data.at(0).get_catDict().has_value());
+
+    incplot::DesiredPlot::DP_CtorStruct dpctrs{
+        .plot_type_name = std::type_index(typeid(incplot::plot_structures::Scatter)),
+        .lts_colID      = 1uz,
+        .v_colIDs       = {2uz},
+        .c_colID        = 0uz};
+    auto dp = incplot::evaluate_onePSpossibility(incplot::DesiredPlot(dpctrs), ds.value());
+    ASSERT_TRUE(dp.has_value());
+    EXPECT_EQ(dp->filterFlags.get_filteredCount(), 4uz);
+
+    // Legend comes from the dictionary of the selected rows (see 'CatDict::get_selected')
+    auto ps = incplot::build_plotStructure(dp.value(), ds.value());
+    ASSERT_TRUE(ps.has_value());
+    ASSERT_TRUE(std::holds_alternative<incplot::plot_structures::Scatter>(ps.value()));
+    auto const &legend       = std::get<incplot::plot_structures::Scatter>(ps.value()).labels_verRight;
+    auto        has_category = [&](std::string_view const cat) {
+        return std::ranges::any_of(legend, [&](auto const &line) { return line.contains(cat); });
+    };
+    EXPECT_TRUE(has_category("Adelie"));
+    EXPECT_TRUE(has_category("Gentoo"));
+    EXPECT_FALSE(has_category("Chinstrap"));
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <incstd/incstd_all.hpp>
+#include <filesystem>
+#include <ranges>
+#include <span>
+
+#include <incplot-lib.hpp>
+#include <tests_config.hpp>
+
+
+using namespace incom::terminal_plot::testing;
+namespace incplot = incom::terminal_plot;
+
+TEST(SnapshotTest, roundTripsParsedData) {
+    auto const path = std::filesystem::temp_directory_path() / "incplot_snapshot_test.incds";
+
+    for (auto const &oneFN : DataSets_FN_transposed::csv) {
+        auto dt = incstd::filesys::get_file_textual(oneFN);
+        ASSERT_TRUE(dt.has_value());
+        auto parsedDS = incplot::parsers::Parser::parse(dt.value());
+        ASSERT_TRUE(parsedDS.has_value());
+
+        ASSERT_TRUE(incplot::snapshot::save(parsedDS.value(), path.string()).has_value());
+        auto loadedDS = incplot::snapshot::load(path.string());
+        ASSERT_TRUE(loadedDS.has_value());
+
+        // Loaded string cells are views into the snapshot, so string columns are compared cell by cell
+        ASSERT_EQ(loadedDS->m_data.size(), parsedDS->m_data.size());
+        for (auto const &[col_L, col_P] : std::views::zip(loadedDS->m_data, parsedDS->m_data)) {
+            EXPECT_EQ(col_L.name, col_P.name);
+            EXPECT_EQ(col_L.get_colType(), col_P.get_colType());
+            EXPECT_EQ(col_L.get_itemFlags(), col_P.get_itemFlags());
+            EXPECT_EQ(col_L.get_catDict().has_value(), col_P.get_catDict().has_value());
+            if (col_P.get_colType() != incplot::parsedVal_t::string_like) {
+                EXPECT_EQ(col_L.get_variantData(), col_P.get_variantData());
+                continue;
+            }
+            EXPECT_TRUE(std::ranges::equal(std::get<std::vector<std::string_view>>(col_L.get_variantData()),
+                                           std::get<std::vector<std::string>>(col_P.get_variantData())));
+            EXPECT_EQ(col_L.get_catDict()->codes, col_P.get_catDict()->codes);
+        }
+    }
+
+    // Truncated snapshot is an error
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    EXPECT_FALSE(incplot::snapshot::load(path.string()).has_value());
+    std::filesystem::remove(path);
+}
+
+TEST(SnapshotTest, roundTripsEmptyColumns) {
+    auto const path = std::filesystem::temp_directory_path() / "incplot_snapshot_empty_test.incds";
+
+    // Columns without any rows are written and read as zero length arrays
+    auto builtDS = incplot::DataStoreBuilder().add_column("vals", std::span<double const>()).build();
+    ASSERT_TRUE(builtDS.has_value());
+    ASSERT_TRUE(incplot::snapshot::save(builtDS.value(), path.string()).has_value());
+
+    auto loadedDS = incplot::snapshot::load(path.string());
+    ASSERT_TRUE(loadedDS.has_value());
+    EXPECT_EQ(loadedDS->get_rowCount(), 0);
+    ASSERT_EQ(loadedDS->m_data.size(), builtDS->m_data.size());
+    for (auto const &[col_L, col_B] : std::views::zip(loadedDS->m_data, builtDS->m_data)) {
+        EXPECT_EQ(col_L.name, col_B.name);
+        EXPECT_EQ(col_L.get_colType(), col_B.get_colType());
+    }
+    std::filesystem::remove(path);
+}